@@ -15,6 +15,7 @@ export GLOBOBJS="  d_items.c"
 export GLOBOBJS+=" d_main.c"
 export GLOBOBJS+=" g_game.c"
 export GLOBOBJS+=" i_amiga.c"
+export GLOBOBJS+=" i_c2p.c"
 export GLOBOBJS+=" info.c"
 export GLOBOBJS+=" m_random.c"
 export GLOBOBJS+=" p_doors.c"
@@ -5,6 +5,7 @@ CCOPTSS="-os -bt=none -0 -zq -s -mm -wx -zastd=c99 -zls -Delks"
 wcc $CCOPTSS d_items.c  -fo=d_items.obj
 wcc $CCOPTSS d_main.c   -fo=d_main.obj
 wcc $CCOPTSS g_game.c   -fo=g_game.obj
+wcc $CCOPTSS i_c2p.c    -fo=i_c2p.obj
 wcc $CCOPTSS i_elks.c   -fo=i_elks.obj
 wcc $CCOPTSS info.c     -fo=info.obj
 wcc $CCOPTSS m_random.c -fo=m_random.obj
@@ -34,7 +35,7 @@ wcc $CCOPTSS v_video.c  -fo=v_video.obj
 wcc $CCOPTSS w_wad.c    -fo=w_wad.obj
 wcc $CCOPTSS z_zone.c   -fo=z_zone.obj
 
-owcc -bos2 -s -Wl,option -Wl,start=_start -Wl,option -Wl,dosseg -Wl,option -Wl,nodefaultlibs -Wl,option -Wl,stack=0x1000 -Wl,option -Wl,heapsize=0x1000 -Wl,library -Wl,$LIBC -o elks/doomtd3.os2 d_items.obj d_main.obj g_game.obj i_elks.obj info.obj m_random.obj p_doors.obj p_enemy.obj p_floor.obj p_inter.obj p_lights.obj p_map.obj p_maputl.obj p_mobj.obj p_plats.obj p_pspr.obj p_scroll.obj p_setup.obj p_sight.obj p_spec.obj p_switch.obj p_tick.obj p_user.obj r_data.obj r_draw.obj r_things.obj st_stuff.obj tables.obj v_video.obj w_wad.obj z_zone.obj
+owcc -bos2 -s -Wl,option -Wl,start=_start -Wl,option -Wl,dosseg -Wl,option -Wl,nodefaultlibs -Wl,option -Wl,stack=0x1000 -Wl,option -Wl,heapsize=0x1000 -Wl,library -Wl,$LIBC -o elks/doomtd3.os2 d_items.obj d_main.obj g_game.obj i_c2p.obj i_elks.obj info.obj m_random.obj p_doors.obj p_enemy.obj p_floor.obj p_inter.obj p_lights.obj p_map.obj p_maputl.obj p_mobj.obj p_plats.obj p_pspr.obj p_scroll.obj p_setup.obj p_sight.obj p_spec.obj p_switch.obj p_tick.obj p_user.obj r_data.obj r_draw.obj r_things.obj st_stuff.obj tables.obj v_video.obj w_wad.obj z_zone.obj
 
 rm *.obj
 rm *.err
@@ -28,6 +28,7 @@ export CFLAGS="-march=$CPU -mcmodel=medium -li86 -mnewlib-nano-stdio -Os -fomit-
 export GLOBOBJS="  d_items.c"
 export GLOBOBJS+=" d_main.c"
 export GLOBOBJS+=" g_game.c"
+export GLOBOBJS+=" i_c2p.c"
 #export GLOBOBJS+=" i_ibm.c"
 export GLOBOBJS+=" i_ibm.o"
 export GLOBOBJS+=" i_ibma.o"
@@ -38,6 +38,8 @@
  */
 
 #include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
 
 #include "doomdef.h"
 #include "doomtype.h"
@@ -135,8 +137,13 @@ static void _Noreturn D_DoomLoop(void)
 // CPhipps - the old contents of D_DoomMain, but moved out of the main
 //  line of execution so its stack space can be freed
 
-static void D_DoomMainSetup(void)
+static void D_DoomMainSetup(int16_t argc, const char * const * argv)
 {
+    // -width <columns> narrows or widens the view window
+    for (int16_t i = 1; i < argc - 1; i++)
+        if (!strcmp("-width", argv[i]))
+            viewwindowwidth = atoi(argv[i + 1]);
+
     // init subsystems
 
     Z_Init();
@@ -160,9 +167,9 @@ static void D_DoomMainSetup(void)
 // D_DoomMain
 //
 
-void D_DoomMain(void)
+void D_DoomMain(int16_t argc, const char * const * argv)
 {
-    D_DoomMainSetup(); // CPhipps - setup out of main execution stack
+    D_DoomMainSetup(argc, argv); // CPhipps - setup out of main execution stack
 
     D_DoomLoop ();  // never returns
 }
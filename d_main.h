@@ -41,7 +41,7 @@
 // BASE LEVEL
 //
 
-void D_DoomMain(void);
+void D_DoomMain(int16_t argc, const char * const * argv);
 
 
 #endif
@@ -59,10 +59,16 @@
 #define UNUSED(x)	(x = x)	// for pesky compiler / lint warnings
 
 
+// VIEWWINDOWWIDTH is the maximum width of the view window,
+// -width selects a narrower one at run time.
 #if !defined VIEWWINDOWWIDTH
 #define VIEWWINDOWWIDTH  60
 #endif
 
+// The height is fixed at compile time. The backends lay out video memory
+// and the status bar from SCREENHEIGHT, some pair it with a vertical
+// resolution mode, and CENTERY, PSPRITEYSCALE and the column drawers'
+// clipping are constants derived from it.
 #if !defined VIEWWINDOWHEIGHT
 #define VIEWWINDOWHEIGHT 128
 #endif
@@ -65,6 +65,7 @@
 #include "p_inter.h"
 #include "g_game.h"
 #include "i_system.h"
+#include "m_stats.h"
 
 #include "globdata.h"
 
@@ -475,12 +476,41 @@ static void G_DoPlayDemo(void)
  *
  * Called after a death or level completion to allow demos to be cleaned up
  */
+#if defined STATISTICS
+statistics_t _g_statistics;
+
+static char statisticsbuffer[480];
+
+static const char* G_StatisticsString(void)
+{
+    uint32_t gametics = (uint16_t) _g_gametic;
+    char* p = statisticsbuffer;
+
+    p += sprintf(p, "\nBSP nodes: %lu per gametic", _g_statistics.bspnodes / gametics);
+    p += sprintf(p, "\nPresented: %lu bytes per gametic", _g_statistics.presentedbytes / gametics);
+    p += sprintf(p, "\nDropped sprites: %lu in total", _g_statistics.droppedsprites);
+    p += sprintf(p, "\nSkipped frames: %lu of %lu", _g_statistics.skippedframes, gametics);
+    p += sprintf(p, "\nColormap loads: %lu per gametic", _g_statistics.colormaploads / gametics);
+    p += sprintf(p, "\nIntercept overflows: %lu in total", _g_statistics.interceptoverflows);
+    p += sprintf(p, "\nSight checks: %lu per gametic", _g_statistics.sightchecks / gametics);
+    p += sprintf(p, "\nSight rejects: %lu, cache hits: %lu", _g_statistics.sightrejects, _g_statistics.sighthits);
+    p += sprintf(p, "\nSector nodes: %lu at most, %lu overflows", _g_statistics.secnodeshighwater, _g_statistics.secnodeoverflows);
+    p += sprintf(p, "\nThinkers: %lu per gametic", _g_statistics.thinkers / gametics);
+    p += sprintf(p, "\nPosition checks: %lu, %lu lines, %lu things", _g_statistics.positionchecks, _g_statistics.linechecks, _g_statistics.thingchecks);
+
+    return statisticsbuffer;
+}
+#else
+#define G_StatisticsString() ""
+#endif
+
 static void G_CheckDemoStatus (void)
 {
     uint32_t realtics = I_EndClock();
     uint32_t resultfps = TICRATE * 1000L * _g_gametic / realtics;
-    I_Error ("Timed %u gametics in %lu realtics = %lu.%.3lu frames per second",
+    I_Error ("Timed %u gametics in %lu realtics = %lu.%.3lu frames per second%s",
              (uint16_t) _g_gametic, realtics,
-             resultfps / 1000, resultfps % 1000);
+             resultfps / 1000, resultfps % 1000,
+             G_StatisticsString());
 }
 
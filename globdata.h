@@ -101,6 +101,7 @@ extern subsector_t __far* _g_subsectors;
 
 extern int16_t      _g_numlines;
 extern line_t   __far* _g_lines;
+extern uint16_t __far* _g_linevalidcounts; // per line, if == validcount, already checked
 
 
 extern side_t   __far* _g_sides;
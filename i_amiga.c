@@ -34,6 +34,7 @@
 #include "compiler.h"
 
 #include "d_main.h"
+#include "i_c2p.h"
 #include "i_system.h"
 #include "m_random.h"
 #include "r_defs.h"
@@ -180,12 +181,16 @@ void I_InitGraphics(void)
 	custom.dmacon = 0x0020;
 	custom.cop1lc = (uint32_t) coplist;
 
-	viewwindowtop = ((PLANEWIDTH - VIEWWINDOWWIDTH)      / 2) + ((screenHeightAmiga - (VIEWWINDOWHEIGHT * DH + ST_HEIGHT)) / 2) * PLANEWIDTH;
+	viewwindowtop = ((PLANEWIDTH - viewwindowwidth)      / 2) + ((screenHeightAmiga - (VIEWWINDOWHEIGHT * DH + ST_HEIGHT)) / 2) * PLANEWIDTH;
 	statusbartop  = ((PLANEWIDTH - SCREENWIDTH * DW / 8) / 2) + ((screenHeightAmiga - (VIEWWINDOWHEIGHT * DH + ST_HEIGHT)) / 2) * PLANEWIDTH + VIEWWINDOWHEIGHT * DH * PLANEWIDTH;
 	_s_viewwindow = screenpage + viewwindowtop;
 
 	_s_statusbar  = Z_MallocStatic(SCREENWIDTH * ST_HEIGHT);
 
+#if HORIZONTAL_RESOLUTION != HORIZONTAL_RESOLUTION_LO
+	I_InitChunkyToPlanar();
+#endif
+
 	OwnBlitter();
 	WaitBlit();
 	custom.bltcon0 = 0b0000100111110000;
@@ -257,70 +262,31 @@ static const uint8_t VGA_TO_BW_LUT[256] =
 #undef B1
 #undef B2
 
-#else
+#endif
 
-#define B0 0
-#define B1 1
-#define B2 3
 
-static const uint8_t VGA_TO_BW_LUT_e[256] =
-{
-	B0, B0, B0, B1, B2, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B1, B1,
-	B1, B1, B1, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2,
-	B2, B1, B1, B1, B1, B1, B1, B1, B1, B1, B1, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2,
-	B1, B1, B1, B1, B1, B1, B1, B1, B1, B1, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B1, B1, B1, B1, B1,
-	B1, B1, B1, B1, B1, B1, B0, B0, B1, B1, B1, B1, B1, B1, B0, B0,
-	B2, B2, B2, B2, B1, B1, B1, B0, B2, B2, B2, B2, B2, B2, B1, B1,
-	B1, B1, B1, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B1, B1, B1, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B1,
-	B2, B2, B2, B2, B2, B2, B2, B2, B1, B1, B1, B0, B0, B0, B0, B0,
-	B0, B0, B0, B0, B0, B0, B0, B0, B2, B2, B2, B1, B1, B0, B0, B1
-};
+#define NO_PALETTE_CHANGE 100
 
-#undef B0
-#undef B1
-#undef B2
+// the status bar of the other screen page is newer than this one
+static boolean st_needcopy = false;
 
-#define B0 0
-#define B1 2
-#define B2 3
+#if defined RENDER_SKIP
+#error RENDER_SKIP needs a view window that survives a page flip
+#endif
 
-static const uint8_t VGA_TO_BW_LUT_o[256] =
+//
+// Copies the status bar of the other screen page with the blitter
+//
+static void I_CopyStatusBar(void)
 {
-	B0, B0, B0, B1, B2, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B1, B1,
-	B1, B1, B1, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2,
-	B2, B1, B1, B1, B1, B1, B1, B1, B1, B1, B1, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2,
-	B1, B1, B1, B1, B1, B1, B1, B1, B1, B1, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B1, B1, B1, B1, B1,
-	B1, B1, B1, B1, B1, B1, B0, B0, B1, B1, B1, B1, B1, B1, B0, B0,
-	B2, B2, B2, B2, B1, B1, B1, B0, B2, B2, B2, B2, B2, B2, B1, B1,
-	B1, B1, B1, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B1, B1, B1, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B1,
-	B2, B2, B2, B2, B2, B2, B2, B2, B1, B1, B1, B0, B0, B0, B0, B0,
-	B0, B0, B0, B0, B0, B0, B0, B0, B2, B2, B2, B1, B1, B0, B0, B1
-};
-
-#undef B0
-#undef B1
-#undef B2
-
-#endif
+	WaitBlit();
 
+	custom.bltapt = (uint8_t*)(screenpaget - (uint32_t)screenpage) + statusbartop;
+	custom.bltdpt = screenpage + statusbartop;
 
-#define NO_PALETTE_CHANGE 100
+	custom.bltsize = (ST_HEIGHT << 6) | ((SCREENWIDTH * DW / 8) / 2);
+}
 
-static uint16_t st_needrefresh = 0;
 
 void I_FinishUpdate(void)
 {
@@ -332,17 +298,27 @@ void I_FinishUpdate(void)
 	}
 
 	// status bar
-	if (st_needrefresh)
+	if (st_numdirtyrects)
 	{
-		st_needrefresh--;
+		if (st_needcopy)
+		{
+			I_CopyStatusBar();
+			WaitBlit();
+		}
 
-		if (st_needrefresh)
+		for (int16_t i = 0; i < st_numdirtyrects; i++)
 		{
-			uint8_t *src = _s_statusbar;
-			uint8_t *dst = screenpage + statusbartop;
+			const st_rect_t* r = &st_dirtyrects[i];
 #if HORIZONTAL_RESOLUTION == HORIZONTAL_RESOLUTION_LO
-			for (uint_fast8_t y = 0; y < ST_HEIGHT; y++) {
-				for (uint_fast8_t x = 0; x < SCREENWIDTH * DW / 8; x++) {
+			// eight pixels per byte
+			const int16_t x1 = r->x / 8;
+			const int16_t x2 = (r->x + r->w + 7) / 8;
+
+			for (int16_t y = r->y; y < r->y + r->h; y++) {
+				const uint8_t *src = &_s_statusbar[y * SCREENWIDTH + x1 * 8];
+				uint8_t *dst = screenpage + statusbartop + y * PLANEWIDTH;
+
+				for (int16_t x = x1; x < x2; x++) {
 					uint8_t c =    VGA_TO_BW_LUT[*src++];
 					c = (c << 1) | VGA_TO_BW_LUT[*src++];
 					c = (c << 1) | VGA_TO_BW_LUT[*src++];
@@ -351,44 +327,26 @@ void I_FinishUpdate(void)
 					c = (c << 1) | VGA_TO_BW_LUT[*src++];
 					c = (c << 1) | VGA_TO_BW_LUT[*src++];
 					c = (c << 1) | VGA_TO_BW_LUT[*src++];
-					*dst++ = c;
+					dst[x] = c;
 				}
-
-				dst += PLANEWIDTH - SCREENWIDTH * DW / 8;
 			}
 #else
-			for (uint_fast8_t y = 0; y < ST_HEIGHT / 2; y++) {
-				for (uint_fast8_t x = 0; x < SCREENWIDTH * DW / 8; x++) {
-					uint8_t c =    VGA_TO_BW_LUT_e[*src++];
-					c = (c << 2) | VGA_TO_BW_LUT_e[*src++];
-					c = (c << 2) | VGA_TO_BW_LUT_e[*src++];
-					c = (c << 2) | VGA_TO_BW_LUT_e[*src++];
-					*dst++ = c;
-				}
-
-				dst += PLANEWIDTH - SCREENWIDTH * DW / 8;
+			// four pixels per byte
+			const int16_t x1 = r->x / 4;
+			const int16_t x2 = (r->x + r->w + 3) / 4;
 
-				for (uint_fast8_t x = 0; x < (SCREENWIDTH * DW / 8); x++) {
-					uint8_t c =    VGA_TO_BW_LUT_o[*src++];
-					c = (c << 2) | VGA_TO_BW_LUT_o[*src++];
-					c = (c << 2) | VGA_TO_BW_LUT_o[*src++];
-					c = (c << 2) | VGA_TO_BW_LUT_o[*src++];
-					*dst++ = c;
-				}
-
-				dst += PLANEWIDTH - SCREENWIDTH * DW / 8;
-			}
+			for (int16_t y = r->y; y < r->y + r->h; y++)
+				I_ChunkyToPlanar(screenpage + statusbartop + y * PLANEWIDTH + x1, &_s_statusbar[y * SCREENWIDTH + x1 * 4], x2 - x1, y & 1, 0);
 #endif
 		}
-		else
-		{
-			WaitBlit();
 
-			custom.bltapt = (uint8_t*)(screenpaget - (uint32_t)screenpage) + statusbartop;
-			custom.bltdpt = screenpage + statusbartop;
-
-			custom.bltsize = (ST_HEIGHT << 6) | ((SCREENWIDTH * DW / 8) / 2);
-		}
+		st_numdirtyrects = 0;
+		st_needcopy = true;
+	}
+	else if (st_needcopy)
+	{
+		st_needcopy = false;
+		I_CopyStatusBar();
 	}
 
 	// page flip
@@ -517,6 +475,76 @@ void R_DrawColumn(const draw_column_vars_t *dcvars)
 }
 
 
+#if defined WIDE_COLUMNS
+//
+// Draws the same column into width adjacent columns,
+// for runs of identical wall columns.
+//
+void R_DrawColumnWide(const draw_column_vars_t *dcvars, int16_t width)
+{
+	int16_t count = (dcvars->yh - dcvars->yl) + 1;
+
+	// Zero length, column does not exceed a pixel.
+	if (count <= 0)
+		return;
+
+	const uint8_t *src = dcvars->source;
+
+	const uint8_t *nearcolormap = dcvars->colormap;
+
+	uint8_t *dst = _s_viewwindow + (dcvars->yl * PLANEWIDTH * DH) + dcvars->x;
+
+	const uint16_t fracstep = dcvars->fracstep;
+	uint16_t frac = (dcvars->texturemid >> COLEXTRABITS) + (dcvars->yl - CENTERY) * fracstep;
+
+	switch (width)
+	{
+		case 2:
+			while (count--)
+			{
+				const uint8_t c = nearcolormap[src[frac>>COLBITS]];
+#if defined VERTICAL_RESOLUTION_DOUBLED
+				dst[PLANEWIDTH] = dst[PLANEWIDTH + 1] = c;
+#endif
+				dst[0] = dst[1] = c;
+				dst += PLANEWIDTH * DH;
+				frac += fracstep;
+			}
+			break;
+
+		case 4:
+			while (count--)
+			{
+				const uint8_t c = nearcolormap[src[frac>>COLBITS]];
+#if defined VERTICAL_RESOLUTION_DOUBLED
+				dst[PLANEWIDTH] = dst[PLANEWIDTH + 1] = dst[PLANEWIDTH + 2] = dst[PLANEWIDTH + 3] = c;
+#endif
+				dst[0] = dst[1] = dst[2] = dst[3] = c;
+				dst += PLANEWIDTH * DH;
+				frac += fracstep;
+			}
+			break;
+
+		default:
+			while (count--)
+			{
+				const uint8_t c = nearcolormap[src[frac>>COLBITS]];
+				for (int16_t i = 0; i < width; i++)
+				{
+#if defined VERTICAL_RESOLUTION_DOUBLED
+					dst[PLANEWIDTH + i] = c;
+#endif
+					dst[i] = c;
+				}
+				dst += PLANEWIDTH * DH;
+				frac += fracstep;
+			}
+			break;
+	}
+}
+#endif
+
+
 static uint8_t swapNibbles(uint8_t color)
 {
 	return (color << 4) | (color >> 4);
@@ -704,10 +732,7 @@ void V_DrawRaw(int16_t num, uint16_t offset)
 void ST_Drawer(void)
 {
 	if (ST_NeedUpdate())
-	{
 		ST_doRefresh();
-		st_needrefresh = 2; //2 screen pages
-	}
 }
 
 
@@ -808,9 +833,6 @@ void I_Error2(const char *error, ...)
 
 int main(int argc, const char * const * argv)
 {
-	UNUSED(argc);
-	UNUSED(argv);
-
-	D_DoomMain();
+	D_DoomMain(argc, argv);
 	return 0;
 }
@@ -0,0 +1,138 @@
+/*-----------------------------------------------------------------------------
+ *
+ *
+ *  Copyright (C) 2026 Frenkel Smeijers
+ *
+ *  This program is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU General Public License
+ *  as published by the Free Software Foundation; either version 2
+ *  of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA
+ *  02111-1307, USA.
+ *
+ * DESCRIPTION:
+ *      Chunky to planar conversion for the 1 bit per pixel backends.
+ *      Every VGA color has one of three intensities.
+ *      A pixel becomes two by two dots of a dither pattern for its intensity.
+ *
+ *      Compile with -DC2P_WIDE_LUT to convert two pixels per lookup.
+ *      That needs 128 kB of tables, so not on 16-bit targets.
+ *
+ *-----------------------------------------------------------------------------*/
+
+#include <stdint.h>
+
+#include "compiler.h"
+
+#include "i_c2p.h"
+
+
+#define L0 0
+#define L1 1
+#define L2 2
+
+static const uint8_t VGA_TO_INTENSITY[256] =
+{
+	L0, L0, L0, L1, L2, L0, L0, L0, L0, L0, L0, L0, L0, L0, L0, L0,
+	L2, L2, L2, L2, L2, L2, L2, L2, L1, L1, L1, L1, L1, L1, L1, L1,
+	L1, L1, L1, L0, L0, L0, L0, L0, L0, L0, L0, L0, L0, L0, L0, L0,
+	L2, L2, L2, L2, L2, L2, L2, L2, L2, L2, L2, L2, L2, L2, L2, L2,
+	L2, L1, L1, L1, L1, L1, L1, L1, L1, L1, L1, L0, L0, L0, L0, L0,
+	L2, L2, L2, L2, L2, L2, L2, L2, L2, L2, L2, L2, L2, L2, L2, L2,
+	L1, L1, L1, L1, L1, L1, L1, L1, L1, L1, L0, L0, L0, L0, L0, L0,
+	L2, L2, L2, L2, L2, L1, L1, L1, L1, L1, L1, L0, L0, L0, L0, L0,
+	L2, L2, L2, L2, L2, L1, L1, L1, L1, L1, L1, L1, L1, L1, L1, L1,
+	L1, L1, L1, L1, L1, L1, L0, L0, L1, L1, L1, L1, L1, L1, L0, L0,
+	L2, L2, L2, L2, L1, L1, L1, L0, L2, L2, L2, L2, L2, L2, L1, L1,
+	L1, L1, L1, L0, L0, L0, L0, L0, L0, L0, L0, L0, L0, L0, L0, L0,
+	L2, L2, L2, L2, L1, L1, L1, L0, L0, L0, L0, L0, L0, L0, L0, L0,
+	L2, L2, L2, L2, L2, L2, L2, L2, L2, L1, L1, L1, L1, L1, L1, L1,
+	L2, L2, L2, L2, L2, L2, L2, L2, L1, L1, L1, L0, L0, L0, L0, L0,
+	L0, L0, L0, L0, L0, L0, L0, L0, L2, L2, L2, L1, L1, L0, L0, L1
+};
+
+#undef L0
+#undef L1
+#undef L2
+
+
+// two dots per pixel per row of the dither pattern
+static const uint8_t dither[2][3] =
+{
+	{0, 1, 3},
+	{0, 2, 3}
+};
+
+
+#if defined C2P_WIDE_LUT
+
+#if defined _M_I86
+#error C2P_WIDE_LUT needs more memory than a 16-bit target has
+#endif
+
+// two pixels per lookup, indexed by (s1 << 8) | s2
+static uint8_t c2ptable[2][256 * 256];
+
+
+void I_InitChunkyToPlanar(void)
+{
+	for (int16_t line = 0; line < 2; line++)
+	{
+		for (int32_t i = 0; i < 256 * 256; i++)
+			c2ptable[line][i] = (dither[line][VGA_TO_INTENSITY[i >> 8]] << 2) | dither[line][VGA_TO_INTENSITY[i & 0xff]];
+	}
+}
+
+
+void I_ChunkyToPlanar(uint8_t __far* dst, const uint8_t __far* src, int16_t count, int16_t line, uint8_t invert)
+{
+	const uint8_t *t = c2ptable[line];
+
+	while (count--)
+	{
+		uint16_t s12 = (src[0] << 8) | src[1];
+		uint16_t s34 = (src[2] << 8) | src[3];
+		*dst++ = ((t[s12] << 4) | t[s34]) ^ invert;
+		src += 4;
+	}
+}
+
+#else
+
+// one pixel per lookup, for every position in a byte
+static uint8_t c2ptable[2][4][256];
+
+
+void I_InitChunkyToPlanar(void)
+{
+	for (int16_t line = 0; line < 2; line++)
+	{
+		for (int16_t p = 0; p < 4; p++)
+		{
+			for (int16_t i = 0; i < 256; i++)
+				c2ptable[line][p][i] = dither[line][VGA_TO_INTENSITY[i]] << (6 - 2 * p);
+		}
+	}
+}
+
+
+void I_ChunkyToPlanar(uint8_t __far* dst, const uint8_t __far* src, int16_t count, int16_t line, uint8_t invert)
+{
+	const uint8_t (*t)[256] = c2ptable[line];
+
+	while (count--)
+	{
+		*dst++ = (t[0][src[0]] | t[1][src[1]] | t[2][src[2]] | t[3][src[3]]) ^ invert;
+		src += 4;
+	}
+}
+
+#endif
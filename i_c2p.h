@@ -0,0 +1,42 @@
+/*-----------------------------------------------------------------------------
+ *
+ *
+ *  Copyright (C) 2026 Frenkel Smeijers
+ *
+ *  This program is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU General Public License
+ *  as published by the Free Software Foundation; either version 2
+ *  of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA
+ *  02111-1307, USA.
+ *
+ * DESCRIPTION:
+ *      Chunky to planar conversion for the 1 bit per pixel backends
+ *
+ *-----------------------------------------------------------------------------*/
+
+#ifndef __I_C2P__
+#define __I_C2P__
+
+#include <stdint.h>
+
+#include "compiler.h"
+
+void I_InitChunkyToPlanar(void);
+
+//
+// Converts count * 4 VGA pixels into count bytes of 2x2 dithered pixels.
+// line selects the row of the dither pattern,
+// invert is xor-ed with every byte.
+//
+void I_ChunkyToPlanar(uint8_t __far* dst, const uint8_t __far* src, int16_t count, int16_t line, uint8_t invert);
+
+#endif
@@ -30,8 +30,10 @@
 #include "compiler.h"
 
 #include "d_main.h"
+#include "i_c2p.h"
 #include "i_system.h"
 #include "m_random.h"
+#include "m_stats.h"
 #include "r_defs.h"
 #include "v_video.h"
 #include "w_wad.h"
@@ -98,12 +100,14 @@ void I_InitGraphics(void)
 {
 	I_SetScreenMode(6);
 
-	videomemory_view      = D_MK_FP(0xb800, ((PLANEWIDTH - VIEWWINDOWWIDTH)     / 2) + (((SCREENHEIGHT_CGA - SCREENHEIGHT) / 2) * PLANEWIDTH) / 2                                     + __djgpp_conventional_base);
+	videomemory_view      = D_MK_FP(0xb800, ((PLANEWIDTH - viewwindowwidth)     / 2) + (((SCREENHEIGHT_CGA - SCREENHEIGHT) / 2) * PLANEWIDTH) / 2                                     + __djgpp_conventional_base);
 	videomemory_statusbar = D_MK_FP(0xb800, ((PLANEWIDTH - SCREENWIDTH * 2 / 8) / 2) + (((SCREENHEIGHT_CGA - SCREENHEIGHT) / 2) * PLANEWIDTH) / 2 + VIEWWINDOWHEIGHT * PLANEWIDTH / 2 + __djgpp_conventional_base);
 
 	_s_viewwindow = Z_MallocStatic(VIEWWINDOWWIDTH * VIEWWINDOWHEIGHT);
 	_s_statusbar  = Z_MallocStatic(SCREENWIDTH * ST_HEIGHT);
 
+	I_InitChunkyToPlanar();
+
 	isGraphicsModeSet = true;
 }
 
@@ -121,273 +125,50 @@ void I_SetPalette(int8_t pal)
 }
 
 
-#define B0 (0 << 0)
-#define B1 (1 << 0)
-#define B2 (3 << 0)
-
-static const uint8_t VGA_TO_BW_LUT_0[256] =
-{
-	B0, B0, B0, B1, B2, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B1, B1,
-	B1, B1, B1, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2,
-	B2, B1, B1, B1, B1, B1, B1, B1, B1, B1, B1, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2,
-	B1, B1, B1, B1, B1, B1, B1, B1, B1, B1, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B1, B1, B1, B1, B1,
-	B1, B1, B1, B1, B1, B1, B0, B0, B1, B1, B1, B1, B1, B1, B0, B0,
-	B2, B2, B2, B2, B1, B1, B1, B0, B2, B2, B2, B2, B2, B2, B1, B1,
-	B1, B1, B1, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B1, B1, B1, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B1,
-	B2, B2, B2, B2, B2, B2, B2, B2, B1, B1, B1, B0, B0, B0, B0, B0,
-	B0, B0, B0, B0, B0, B0, B0, B0, B2, B2, B2, B1, B1, B0, B0, B1
-};
-
-#undef B0
-#undef B1
-#undef B2
-
-#define B0 (0 << 0)
-#define B1 (2 << 0)
-#define B2 (3 << 0)
-
-static const uint8_t VGA_TO_BW_LUT_0b[256] =
-{
-	B0, B0, B0, B1, B2, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B1, B1,
-	B1, B1, B1, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2,
-	B2, B1, B1, B1, B1, B1, B1, B1, B1, B1, B1, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2,
-	B1, B1, B1, B1, B1, B1, B1, B1, B1, B1, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B1, B1, B1, B1, B1,
-	B1, B1, B1, B1, B1, B1, B0, B0, B1, B1, B1, B1, B1, B1, B0, B0,
-	B2, B2, B2, B2, B1, B1, B1, B0, B2, B2, B2, B2, B2, B2, B1, B1,
-	B1, B1, B1, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B1, B1, B1, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B1,
-	B2, B2, B2, B2, B2, B2, B2, B2, B1, B1, B1, B0, B0, B0, B0, B0,
-	B0, B0, B0, B0, B0, B0, B0, B0, B2, B2, B2, B1, B1, B0, B0, B1
-};
-
-#undef B0
-#undef B1
-#undef B2
-
-#define B0 (0 << 2)
-#define B1 (1 << 2)
-#define B2 (3 << 2)
-
-static const uint8_t VGA_TO_BW_LUT_1[256] =
-{
-	B0, B0, B0, B1, B2, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B1, B1,
-	B1, B1, B1, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2,
-	B2, B1, B1, B1, B1, B1, B1, B1, B1, B1, B1, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2,
-	B1, B1, B1, B1, B1, B1, B1, B1, B1, B1, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B1, B1, B1, B1, B1,
-	B1, B1, B1, B1, B1, B1, B0, B0, B1, B1, B1, B1, B1, B1, B0, B0,
-	B2, B2, B2, B2, B1, B1, B1, B0, B2, B2, B2, B2, B2, B2, B1, B1,
-	B1, B1, B1, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B1, B1, B1, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B1,
-	B2, B2, B2, B2, B2, B2, B2, B2, B1, B1, B1, B0, B0, B0, B0, B0,
-	B0, B0, B0, B0, B0, B0, B0, B0, B2, B2, B2, B1, B1, B0, B0, B1
-};
-
-#undef B0
-#undef B1
-#undef B2
-
-#define B0 (0 << 2)
-#define B1 (2 << 2)
-#define B2 (3 << 2)
-
-static const uint8_t VGA_TO_BW_LUT_1b[256] =
-{
-	B0, B0, B0, B1, B2, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B1, B1,
-	B1, B1, B1, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2,
-	B2, B1, B1, B1, B1, B1, B1, B1, B1, B1, B1, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2,
-	B1, B1, B1, B1, B1, B1, B1, B1, B1, B1, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B1, B1, B1, B1, B1,
-	B1, B1, B1, B1, B1, B1, B0, B0, B1, B1, B1, B1, B1, B1, B0, B0,
-	B2, B2, B2, B2, B1, B1, B1, B0, B2, B2, B2, B2, B2, B2, B1, B1,
-	B1, B1, B1, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B1, B1, B1, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B1,
-	B2, B2, B2, B2, B2, B2, B2, B2, B1, B1, B1, B0, B0, B0, B0, B0,
-	B0, B0, B0, B0, B0, B0, B0, B0, B2, B2, B2, B1, B1, B0, B0, B1
-};
-
-#undef B0
-#undef B1
-#undef B2
-
-#define B0 (0 << 4)
-#define B1 (1 << 4)
-#define B2 (3 << 4)
-
-static const uint8_t VGA_TO_BW_LUT_2[256] =
-{
-	B0, B0, B0, B1, B2, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B1, B1,
-	B1, B1, B1, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2,
-	B2, B1, B1, B1, B1, B1, B1, B1, B1, B1, B1, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2,
-	B1, B1, B1, B1, B1, B1, B1, B1, B1, B1, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B1, B1, B1, B1, B1,
-	B1, B1, B1, B1, B1, B1, B0, B0, B1, B1, B1, B1, B1, B1, B0, B0,
-	B2, B2, B2, B2, B1, B1, B1, B0, B2, B2, B2, B2, B2, B2, B1, B1,
-	B1, B1, B1, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B1, B1, B1, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B1,
-	B2, B2, B2, B2, B2, B2, B2, B2, B1, B1, B1, B0, B0, B0, B0, B0,
-	B0, B0, B0, B0, B0, B0, B0, B0, B2, B2, B2, B1, B1, B0, B0, B1
-};
-
-#undef B0
-#undef B1
-#undef B2
-
-#define B0 (0 << 4)
-#define B1 (2 << 4)
-#define B2 (3 << 4)
-
-static const uint8_t VGA_TO_BW_LUT_2b[256] =
-{
-	B0, B0, B0, B1, B2, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B1, B1,
-	B1, B1, B1, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2,
-	B2, B1, B1, B1, B1, B1, B1, B1, B1, B1, B1, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2,
-	B1, B1, B1, B1, B1, B1, B1, B1, B1, B1, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B1, B1, B1, B1, B1,
-	B1, B1, B1, B1, B1, B1, B0, B0, B1, B1, B1, B1, B1, B1, B0, B0,
-	B2, B2, B2, B2, B1, B1, B1, B0, B2, B2, B2, B2, B2, B2, B1, B1,
-	B1, B1, B1, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B1, B1, B1, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B1,
-	B2, B2, B2, B2, B2, B2, B2, B2, B1, B1, B1, B0, B0, B0, B0, B0,
-	B0, B0, B0, B0, B0, B0, B0, B0, B2, B2, B2, B1, B1, B0, B0, B1
-};
-
-#undef B0
-#undef B1
-#undef B2
-
-#define B0 (0 << 6)
-#define B1 (1 << 6)
-#define B2 (3 << 6)
-
-static const uint8_t VGA_TO_BW_LUT_3[256] =
-{
-	B0, B0, B0, B1, B2, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B1, B1,
-	B1, B1, B1, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2,
-	B2, B1, B1, B1, B1, B1, B1, B1, B1, B1, B1, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2,
-	B1, B1, B1, B1, B1, B1, B1, B1, B1, B1, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B1, B1, B1, B1, B1,
-	B1, B1, B1, B1, B1, B1, B0, B0, B1, B1, B1, B1, B1, B1, B0, B0,
-	B2, B2, B2, B2, B1, B1, B1, B0, B2, B2, B2, B2, B2, B2, B1, B1,
-	B1, B1, B1, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B1, B1, B1, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B1,
-	B2, B2, B2, B2, B2, B2, B2, B2, B1, B1, B1, B0, B0, B0, B0, B0,
-	B0, B0, B0, B0, B0, B0, B0, B0, B2, B2, B2, B1, B1, B0, B0, B1
-};
-
-#undef B0
-#undef B1
-#undef B2
-
-#define B0 (0 << 6)
-#define B1 (2 << 6)
-#define B2 (3 << 6)
-
-static const uint8_t VGA_TO_BW_LUT_3b[256] =
-{
-	B0, B0, B0, B1, B2, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B1, B1,
-	B1, B1, B1, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2,
-	B2, B1, B1, B1, B1, B1, B1, B1, B1, B1, B1, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2,
-	B1, B1, B1, B1, B1, B1, B1, B1, B1, B1, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B1, B1, B1, B1, B1,
-	B1, B1, B1, B1, B1, B1, B0, B0, B1, B1, B1, B1, B1, B1, B0, B0,
-	B2, B2, B2, B2, B1, B1, B1, B0, B2, B2, B2, B2, B2, B2, B1, B1,
-	B1, B1, B1, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B1, B1, B1, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B1,
-	B2, B2, B2, B2, B2, B2, B2, B2, B1, B1, B1, B0, B0, B0, B0, B0,
-	B0, B0, B0, B0, B0, B0, B0, B0, B2, B2, B2, B1, B1, B0, B0, B1
-};
-
-#undef B0
-#undef B1
-#undef B2
-
-
-static boolean refreshStatusBar;
 
 
-void I_FinishUpdate(void)
+static void I_FinishViewWindow(void)
 {
-	// view window
 	uint8_t __far* src = _s_viewwindow;
 	uint8_t __far* dst = videomemory_view;
 
 	for (uint_fast8_t y = 0; y < VIEWWINDOWHEIGHT / 2; y++) {
-		_fmemcpy(dst, src, VIEWWINDOWWIDTH);
+		_fmemcpy(dst, src, viewwindowwidth);
 
 		dst += 0x2000;
 		src += VIEWWINDOWWIDTH;
 
-		_fmemcpy(dst, src, VIEWWINDOWWIDTH);
+		_fmemcpy(dst, src, viewwindowwidth);
 
 		dst -= 0x2000 - PLANEWIDTH;
 		src += VIEWWINDOWWIDTH;
 	}
+}
 
-	// status bar
-	if (refreshStatusBar)
-	{
-		refreshStatusBar = false;
 
-		uint8_t __far* src = _s_statusbar;
-		dst = videomemory_statusbar;
-		for (uint_fast8_t y = 0; y < ST_HEIGHT / 2; y++) {
-			for (uint_fast8_t x = 0; x < (SCREENWIDTH * 2 / 8); x++) {
-				*dst++ = (VGA_TO_BW_LUT_3[*src++] | VGA_TO_BW_LUT_2[*src++] | VGA_TO_BW_LUT_1[*src++] | VGA_TO_BW_LUT_0[*src++]);
-			}
+void I_FinishUpdate(void)
+{
+	// view window
+#if defined RENDER_SKIP
+	if (viewwindowchanged)
+#endif
+		I_FinishViewWindow();
 
-			dst += 0x2000 - (SCREENWIDTH * 2 / 8);
+	// status bar
+	for (int16_t i = 0; i < st_numdirtyrects; i++)
+	{
+		const st_rect_t* r = &st_dirtyrects[i];
 
-			for (uint_fast8_t x = 0; x < (SCREENWIDTH * 2 / 8); x++) {
-				*dst++ = (VGA_TO_BW_LUT_3b[*src++] | VGA_TO_BW_LUT_2b[*src++] | VGA_TO_BW_LUT_1b[*src++] | VGA_TO_BW_LUT_0b[*src++]);
-			}
+		// four pixels per byte
+		const int16_t x1 = r->x / 4;
+		const int16_t x2 = (r->x + r->w + 3) / 4;
 
-			dst -= 0x2000 - (PLANEWIDTH - (SCREENWIDTH * 2 / 8));
-		}
+		// odd lines are in the second bank
+		for (int16_t y = r->y; y < r->y + r->h; y++)
+			I_ChunkyToPlanar(videomemory_statusbar + (y / 2) * PLANEWIDTH + (y & 1) * 0x2000 + x1, &_s_statusbar[y * SCREENWIDTH + x1 * 4], x2 - x1, y & 1, 0);
 	}
+
+	st_numdirtyrects = 0;
 }
 
 
@@ -420,6 +201,7 @@ void R_DrawColumn(const draw_column_vars_t *dcvars)
 	{
 		_fmemcpy(nearcolormap, dcvars->colormap, 256);
 		nearcolormapoffset = L_FP_OFF(dcvars->colormap);
+		STAT_INC(colormaploads);
 	}
 
 	uint8_t __far* dst = _s_viewwindow + (dcvars->yl * VIEWWINDOWWIDTH) + dcvars->x;
@@ -436,6 +218,70 @@ void R_DrawColumn(const draw_column_vars_t *dcvars)
 }
 
 
+#if defined WIDE_COLUMNS
+//
+// Draws the same column into width adjacent columns,
+// for runs of identical wall columns.
+//
+void R_DrawColumnWide(const draw_column_vars_t *dcvars, int16_t width)
+{
+	int16_t count = (dcvars->yh - dcvars->yl) + 1;
+
+	// Zero length, column does not exceed a pixel.
+	if (count <= 0)
+		return;
+
+	const uint8_t __far* src = dcvars->source;
+
+	if (nearcolormapoffset != L_FP_OFF(dcvars->colormap))
+	{
+		_fmemcpy(nearcolormap, dcvars->colormap, 256);
+		nearcolormapoffset = L_FP_OFF(dcvars->colormap);
+		STAT_INC(colormaploads);
+	}
+
+	uint8_t __far* dst = _s_viewwindow + (dcvars->yl * VIEWWINDOWWIDTH) + dcvars->x;
+
+	const uint16_t fracstep = dcvars->fracstep;
+	uint16_t frac = (dcvars->texturemid >> COLEXTRABITS) + (dcvars->yl - CENTERY) * fracstep;
+
+	switch (width)
+	{
+		case 2:
+			while (count--)
+			{
+				const uint8_t c = nearcolormap[src[frac>>COLBITS]];
+				dst[0] = dst[1] = c;
+				dst += VIEWWINDOWWIDTH;
+				frac += fracstep;
+			}
+			break;
+
+		case 4:
+			while (count--)
+			{
+				const uint8_t c = nearcolormap[src[frac>>COLBITS]];
+				dst[0] = dst[1] = dst[2] = dst[3] = c;
+				dst += VIEWWINDOWWIDTH;
+				frac += fracstep;
+			}
+			break;
+
+		default:
+			while (count--)
+			{
+				const uint8_t c = nearcolormap[src[frac>>COLBITS]];
+				for (int16_t i = 0; i < width; i++)
+					dst[i] = c;
+				dst += VIEWWINDOWWIDTH;
+				frac += fracstep;
+			}
+			break;
+	}
+}
+#endif
+
+
 void R_DrawColumnFlat(uint8_t col, const draw_column_vars_t *dcvars)
 {
 	int16_t count = (dcvars->yh - dcvars->yl) + 1;
@@ -497,6 +343,7 @@ void R_DrawFuzzColumn(const draw_column_vars_t *dcvars)
 	{
 		_fmemcpy(nearcolormap, &fullcolormap[6 * 256], 256);
 		nearcolormapoffset = L_FP_OFF(&fullcolormap[6 * 256]);
+		STAT_INC(colormaploads);
 	}
 
 	uint8_t __far* dest = _s_viewwindow + (dc_yl * VIEWWINDOWWIDTH) + dcvars->x;
@@ -518,8 +365,6 @@ void R_DrawFuzzColumn(const draw_column_vars_t *dcvars)
 
 void V_DrawRaw(int16_t num, uint16_t offset)
 {
-	refreshStatusBar = true;
-
 	const uint8_t __far* lump = W_TryGetLumpByNum(num);
 
 	if (lump != NULL)
@@ -679,10 +524,7 @@ void I_Error2(const char *error, ...)
 
 int main(int argc, const char * const * argv)
 {
-	UNUSED(argc);
-	UNUSED(argv);
-
-	D_DoomMain();
+	D_DoomMain(argc, argv);
 	return 0;
 }
 
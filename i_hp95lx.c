@@ -32,6 +32,8 @@
 
 #include "d_main.h"
 #include "i_system.h"
+#include "m_stats.h"
+#include "r_main.h"
 #include "w_wad.h"
 
 
@@ -82,6 +84,11 @@ void I_SetPalette(int8_t pal)
 
 void I_FinishUpdate(void)
 {
+#if defined RENDER_SKIP
+	if (!viewwindowchanged)
+		return;
+#endif
+
 	// view window
 #if defined EGA_DEBUG
 #define PLANEWIDTH 40
@@ -89,13 +96,26 @@ void I_FinishUpdate(void)
 	uint8_t __far* dst = videomemory;
 
 	for (uint_fast8_t y = 0; y < VIEWWINDOWHEIGHT; y++) {
-		_fmemcpy(dst, src, VIEWWINDOWWIDTH);
+		_fmemcpy(dst, src, viewwindowwidth);
 
 		dst += PLANEWIDTH;
 		src += VIEWWINDOWWIDTH;
 	}
 #else
-	_fmemcpy(videomemory, &_s_viewwindow[0], VIEWWINDOWWIDTH * VIEWWINDOWHEIGHT);
+	if (viewwindowwidth == VIEWWINDOWWIDTH)
+		_fmemcpy(videomemory, &_s_viewwindow[0], VIEWWINDOWWIDTH * VIEWWINDOWHEIGHT);
+	else
+	{
+		uint8_t *src = &_s_viewwindow[0];
+		uint8_t __far* dst = videomemory + (VIEWWINDOWWIDTH - viewwindowwidth) / 2;
+
+		for (uint_fast8_t y = 0; y < VIEWWINDOWHEIGHT; y++) {
+			_fmemcpy(dst, src, viewwindowwidth);
+
+			dst += VIEWWINDOWWIDTH;
+			src += VIEWWINDOWWIDTH;
+		}
+	}
 #endif
 }
 
@@ -118,6 +138,7 @@ void R_InitColormaps(void)
 
 
 #define COLEXTRABITS (8 - 1)
+#define COLBITS (8 + 1)
 
 uint8_t nearcolormap[256];
 
@@ -144,6 +165,7 @@ void R_DrawColumn(const draw_column_vars_t *dcvars)
 	{
 		_fmemcpy(nearcolormap, dcvars->colormap, 256);
 		nearcolormapoffset = D_FP_OFF(dcvars->colormap);
+		STAT_INC(colormaploads);
 	}
 
 	dest = &_s_viewwindow[(dcvars->yl * VIEWWINDOWWIDTH) + dcvars->x];
@@ -155,6 +177,70 @@ void R_DrawColumn(const draw_column_vars_t *dcvars)
 }
 
 
+#if defined WIDE_COLUMNS
+//
+// Draws the same column into width adjacent columns,
+// for runs of identical wall columns.
+//
+void R_DrawColumnWide(const draw_column_vars_t *dcvars, int16_t width)
+{
+	int16_t count = (dcvars->yh - dcvars->yl) + 1;
+
+	// Zero length, column does not exceed a pixel.
+	if (count <= 0)
+		return;
+
+	const uint8_t __far* src = dcvars->source;
+
+	if (nearcolormapoffset != D_FP_OFF(dcvars->colormap))
+	{
+		_fmemcpy(nearcolormap, dcvars->colormap, 256);
+		nearcolormapoffset = D_FP_OFF(dcvars->colormap);
+		STAT_INC(colormaploads);
+	}
+
+	uint8_t *dst = &_s_viewwindow[(dcvars->yl * VIEWWINDOWWIDTH) + dcvars->x];
+
+	const uint16_t fracstep = dcvars->fracstep;
+	uint16_t frac = (dcvars->texturemid >> COLEXTRABITS) + (dcvars->yl - CENTERY) * fracstep;
+
+	switch (width)
+	{
+		case 2:
+			while (count--)
+			{
+				const uint8_t c = nearcolormap[src[frac>>COLBITS]];
+				dst[0] = dst[1] = c;
+				dst += VIEWWINDOWWIDTH;
+				frac += fracstep;
+			}
+			break;
+
+		case 4:
+			while (count--)
+			{
+				const uint8_t c = nearcolormap[src[frac>>COLBITS]];
+				dst[0] = dst[1] = dst[2] = dst[3] = c;
+				dst += VIEWWINDOWWIDTH;
+				frac += fracstep;
+			}
+			break;
+
+		default:
+			while (count--)
+			{
+				const uint8_t c = nearcolormap[src[frac>>COLBITS]];
+				for (int16_t i = 0; i < width; i++)
+					dst[i] = c;
+				dst += VIEWWINDOWWIDTH;
+				frac += fracstep;
+			}
+			break;
+	}
+}
+#endif
+
+
 void R_DrawColumnFlat(uint8_t col, const draw_column_vars_t *dcvars)
 {
 	int16_t count = (dcvars->yh - dcvars->yl) + 1;
@@ -216,6 +302,7 @@ void R_DrawFuzzColumn(const draw_column_vars_t *dcvars)
 	{
 		_fmemcpy(nearcolormap, &fullcolormap[6 * 256], 256);
 		nearcolormapoffset = D_FP_OFF(&fullcolormap[6 * 256]);
+		STAT_INC(colormaploads);
 	}
 
 	uint8_t *dest = &_s_viewwindow[(dc_yl * VIEWWINDOWWIDTH) + dcvars->x];
@@ -391,6 +478,6 @@ void I_Error2(const char *error, ...)
 
 int main(int argc, const char * const * argv)
 {
-	D_DoomMain();
+	D_DoomMain(argc, argv);
 	return 0;
 }
@@ -27,13 +27,16 @@
 #include <dos.h>
 #include <stdarg.h>
 #include <stdint.h>
+#include <string.h>
 #include <time.h>
 
 #include "compiler.h"
 
 #include "d_main.h"
+#include "i_c2p.h"
 #include "i_system.h"
 #include "m_random.h"
+#include "m_stats.h"
 #include "r_defs.h"
 #include "v_video.h"
 #include "w_wad.h"
@@ -84,11 +87,13 @@ void I_InitGraphics(void)
 	I_UploadNewPalette(0);
 
 	__djgpp_nearptr_enable();
-	videomemory_view      = D_MK_FP(0xb800, ((PLANEWIDTH - VIEWWINDOWWIDTH)     / 2) + (((SCREENHEIGHT_CGA - SCREENHEIGHT) / 2) * PLANEWIDTH) / 2                                     + __djgpp_conventional_base);
+	videomemory_view      = D_MK_FP(0xb800, ((PLANEWIDTH - viewwindowwidth)     / 2) + (((SCREENHEIGHT_CGA - SCREENHEIGHT) / 2) * PLANEWIDTH) / 2                                     + __djgpp_conventional_base);
 	videomemory_statusbar = D_MK_FP(0xb800, ((PLANEWIDTH - SCREENWIDTH * 2 / 8) / 2) + (((SCREENHEIGHT_CGA - SCREENHEIGHT) / 2) * PLANEWIDTH) / 2 + VIEWWINDOWHEIGHT * PLANEWIDTH / 2 + __djgpp_conventional_base);
 
 	_s_statusbar = Z_MallocStatic(SCREENWIDTH * ST_HEIGHT);
 
+	I_InitChunkyToPlanar();
+
 	isGraphicsModeSet = true;
 }
 
@@ -109,235 +114,105 @@ void I_SetPalette(int8_t pal)
 }
 
 
-#define B0 (0 << 0)
-#define B1 (1 << 0)
-#define B2 (3 << 0)
-
-static const uint8_t VGA_TO_BW_LUT_0[256] =
-{
-	B0, B0, B0, B1, B2, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B1, B1,
-	B1, B1, B1, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2,
-	B2, B1, B1, B1, B1, B1, B1, B1, B1, B1, B1, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2,
-	B1, B1, B1, B1, B1, B1, B1, B1, B1, B1, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B1, B1, B1, B1, B1,
-	B1, B1, B1, B1, B1, B1, B0, B0, B1, B1, B1, B1, B1, B1, B0, B0,
-	B2, B2, B2, B2, B1, B1, B1, B0, B2, B2, B2, B2, B2, B2, B1, B1,
-	B1, B1, B1, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B1, B1, B1, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B1,
-	B2, B2, B2, B2, B2, B2, B2, B2, B1, B1, B1, B0, B0, B0, B0, B0,
-	B0, B0, B0, B0, B0, B0, B0, B0, B2, B2, B2, B1, B1, B0, B0, B1
-};
+#define NO_PALETTE_CHANGE 100
 
-#undef B0
-#undef B1
-#undef B2
+static uint8_t lcd = 0;
 
-#define B0 (0 << 0)
-#define B1 (2 << 0)
-#define B2 (3 << 0)
 
-static const uint8_t VGA_TO_BW_LUT_0b[256] =
-{
-	B0, B0, B0, B1, B2, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B1, B1,
-	B1, B1, B1, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2,
-	B2, B1, B1, B1, B1, B1, B1, B1, B1, B1, B1, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2,
-	B1, B1, B1, B1, B1, B1, B1, B1, B1, B1, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B1, B1, B1, B1, B1,
-	B1, B1, B1, B1, B1, B1, B0, B0, B1, B1, B1, B1, B1, B1, B0, B0,
-	B2, B2, B2, B2, B1, B1, B1, B0, B2, B2, B2, B2, B2, B2, B1, B1,
-	B1, B1, B1, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B1, B1, B1, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B1,
-	B2, B2, B2, B2, B2, B2, B2, B2, B1, B1, B1, B0, B0, B0, B0, B0,
-	B0, B0, B0, B0, B0, B0, B0, B0, B2, B2, B2, B1, B1, B0, B0, B1
-};
+#if defined DIRTY_SPANS
+#if VIEWWINDOWWIDTH % 2 != 0
+#error DIRTY_SPANS needs an even VIEWWINDOWWIDTH
+#endif
 
-#undef B0
-#undef B1
-#undef B2
+// The view window as it was last copied to video memory
+static uint16_t presentedview[VIEWWINDOWWIDTH * VIEWWINDOWHEIGHT / 2];
+static boolean presentall = true;
 
-#define B0 (0 << 2)
-#define B1 (1 << 2)
-#define B2 (3 << 2)
 
-static const uint8_t VGA_TO_BW_LUT_1[256] =
+static uint16_t I_ViewWord(const uint8_t *src, int16_t i)
 {
-	B0, B0, B0, B1, B2, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B1, B1,
-	B1, B1, B1, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2,
-	B2, B1, B1, B1, B1, B1, B1, B1, B1, B1, B1, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2,
-	B1, B1, B1, B1, B1, B1, B1, B1, B1, B1, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B1, B1, B1, B1, B1,
-	B1, B1, B1, B1, B1, B1, B0, B0, B1, B1, B1, B1, B1, B1, B0, B0,
-	B2, B2, B2, B2, B1, B1, B1, B0, B2, B2, B2, B2, B2, B2, B1, B1,
-	B1, B1, B1, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B1, B1, B1, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B1,
-	B2, B2, B2, B2, B2, B2, B2, B2, B1, B1, B1, B0, B0, B0, B0, B0,
-	B0, B0, B0, B0, B0, B0, B0, B0, B2, B2, B2, B1, B1, B0, B0, B1
-};
-
-#undef B0
-#undef B1
-#undef B2
+	uint16_t w;
+	memcpy(&w, src + i * 2, 2);
+	return w;
+}
 
-#define B0 (0 << 2)
-#define B1 (2 << 2)
-#define B2 (3 << 2)
 
-static const uint8_t VGA_TO_BW_LUT_1b[256] =
+//
+// Copy only the changed part of a view window row to video memory.
+// The changed span is found a word at a time from both ends of the row.
+//
+static void I_PresentRow(uint8_t __far* dst, const uint8_t *src, uint16_t *presented)
 {
-	B0, B0, B0, B1, B2, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B1, B1,
-	B1, B1, B1, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2,
-	B2, B1, B1, B1, B1, B1, B1, B1, B1, B1, B1, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2,
-	B1, B1, B1, B1, B1, B1, B1, B1, B1, B1, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B1, B1, B1, B1, B1,
-	B1, B1, B1, B1, B1, B1, B0, B0, B1, B1, B1, B1, B1, B1, B0, B0,
-	B2, B2, B2, B2, B1, B1, B1, B0, B2, B2, B2, B2, B2, B2, B1, B1,
-	B1, B1, B1, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B1, B1, B1, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B1,
-	B2, B2, B2, B2, B2, B2, B2, B2, B1, B1, B1, B0, B0, B0, B0, B0,
-	B0, B0, B0, B0, B0, B0, B0, B0, B2, B2, B2, B1, B1, B0, B0, B1
-};
+	int16_t first = 0;
+	int16_t last  = (viewwindowwidth - 1) / 2;
 
-#undef B0
-#undef B1
-#undef B2
+	while (first <= last && I_ViewWord(src, first) == presented[first])
+		first++;
 
-#define B0 (0 << 4)
-#define B1 (1 << 4)
-#define B2 (3 << 4)
+	if (first > last)
+		return;
 
-static const uint8_t VGA_TO_BW_LUT_2[256] =
-{
-	B0, B0, B0, B1, B2, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B1, B1,
-	B1, B1, B1, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2,
-	B2, B1, B1, B1, B1, B1, B1, B1, B1, B1, B1, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2,
-	B1, B1, B1, B1, B1, B1, B1, B1, B1, B1, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B1, B1, B1, B1, B1,
-	B1, B1, B1, B1, B1, B1, B0, B0, B1, B1, B1, B1, B1, B1, B0, B0,
-	B2, B2, B2, B2, B1, B1, B1, B0, B2, B2, B2, B2, B2, B2, B1, B1,
-	B1, B1, B1, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B1, B1, B1, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B1,
-	B2, B2, B2, B2, B2, B2, B2, B2, B1, B1, B1, B0, B0, B0, B0, B0,
-	B0, B0, B0, B0, B0, B0, B0, B0, B2, B2, B2, B1, B1, B0, B0, B1
-};
+	while (I_ViewWord(src, last) == presented[last])
+		last--;
 
-#undef B0
-#undef B1
-#undef B2
+	memcpy(presented + first, src + first * 2, (last - first + 1) * 2);
+
+	int16_t x1 = first * 2;
+	int16_t x2 = last  * 2 + 2;
+	if (x2 > viewwindowwidth)
+		x2 = viewwindowwidth;
+
+	_fmemcpy(dst + x1, src + x1, x2 - x1);
+	STAT_ADD(presentedbytes, x2 - x1);
+}
+#endif
 
-#define B0 (0 << 4)
-#define B1 (2 << 4)
-#define B2 (3 << 4)
 
-static const uint8_t VGA_TO_BW_LUT_2b[256] =
+static void I_FinishViewWindow(void)
 {
-	B0, B0, B0, B1, B2, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B1, B1,
-	B1, B1, B1, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2,
-	B2, B1, B1, B1, B1, B1, B1, B1, B1, B1, B1, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2,
-	B1, B1, B1, B1, B1, B1, B1, B1, B1, B1, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B1, B1, B1, B1, B1,
-	B1, B1, B1, B1, B1, B1, B0, B0, B1, B1, B1, B1, B1, B1, B0, B0,
-	B2, B2, B2, B2, B1, B1, B1, B0, B2, B2, B2, B2, B2, B2, B1, B1,
-	B1, B1, B1, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B1, B1, B1, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B1,
-	B2, B2, B2, B2, B2, B2, B2, B2, B1, B1, B1, B0, B0, B0, B0, B0,
-	B0, B0, B0, B0, B0, B0, B0, B0, B2, B2, B2, B1, B1, B0, B0, B1
-};
+	uint8_t *src = &_s_viewwindow[0];
+	uint8_t __far* dst = videomemory_view;
 
-#undef B0
-#undef B1
-#undef B2
+#if defined DIRTY_SPANS
+	uint16_t *presented = presentedview;
 
-#define B0 (0 << 6)
-#define B1 (1 << 6)
-#define B2 (3 << 6)
+	if (presentall)
+	{
+		// make every word differ, so the first frame is copied completely
+		presentall = false;
+		memcpy(presentedview, _s_viewwindow, sizeof(presentedview));
+		for (uint16_t i = 0; i < VIEWWINDOWWIDTH * VIEWWINDOWHEIGHT / 2; i++)
+			presentedview[i] = ~presentedview[i];
+	}
 
-static const uint8_t VGA_TO_BW_LUT_3[256] =
-{
-	B0, B0, B0, B1, B2, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B1, B1,
-	B1, B1, B1, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2,
-	B2, B1, B1, B1, B1, B1, B1, B1, B1, B1, B1, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2,
-	B1, B1, B1, B1, B1, B1, B1, B1, B1, B1, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B1, B1, B1, B1, B1,
-	B1, B1, B1, B1, B1, B1, B0, B0, B1, B1, B1, B1, B1, B1, B0, B0,
-	B2, B2, B2, B2, B1, B1, B1, B0, B2, B2, B2, B2, B2, B2, B1, B1,
-	B1, B1, B1, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B1, B1, B1, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B1,
-	B2, B2, B2, B2, B2, B2, B2, B2, B1, B1, B1, B0, B0, B0, B0, B0,
-	B0, B0, B0, B0, B0, B0, B0, B0, B2, B2, B2, B1, B1, B0, B0, B1
-};
+	for (uint_fast8_t y = 0; y < VIEWWINDOWHEIGHT / 2; y++) {
+		I_PresentRow(dst, src, presented);
 
-#undef B0
-#undef B1
-#undef B2
+		dst       += 0x2000;
+		src       += VIEWWINDOWWIDTH;
+		presented += VIEWWINDOWWIDTH / 2;
 
-#define B0 (0 << 6)
-#define B1 (2 << 6)
-#define B2 (3 << 6)
+		I_PresentRow(dst, src, presented);
 
-static const uint8_t VGA_TO_BW_LUT_3b[256] =
-{
-	B0, B0, B0, B1, B2, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B1, B1,
-	B1, B1, B1, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2,
-	B2, B1, B1, B1, B1, B1, B1, B1, B1, B1, B1, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2,
-	B1, B1, B1, B1, B1, B1, B1, B1, B1, B1, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B1, B1, B1, B1, B1,
-	B1, B1, B1, B1, B1, B1, B0, B0, B1, B1, B1, B1, B1, B1, B0, B0,
-	B2, B2, B2, B2, B1, B1, B1, B0, B2, B2, B2, B2, B2, B2, B1, B1,
-	B1, B1, B1, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B1, B1, B1, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B1,
-	B2, B2, B2, B2, B2, B2, B2, B2, B1, B1, B1, B0, B0, B0, B0, B0,
-	B0, B0, B0, B0, B0, B0, B0, B0, B2, B2, B2, B1, B1, B0, B0, B1
-};
+		dst       -= 0x2000 - PLANEWIDTH;
+		src       += VIEWWINDOWWIDTH;
+		presented += VIEWWINDOWWIDTH / 2;
+	}
+#else
+	for (uint_fast8_t y = 0; y < VIEWWINDOWHEIGHT / 2; y++) {
+		_fmemcpy(dst, src, viewwindowwidth);
 
-#undef B0
-#undef B1
-#undef B2
+		dst += 0x2000;
+		src += VIEWWINDOWWIDTH;
 
+		_fmemcpy(dst, src, viewwindowwidth);
 
-#define NO_PALETTE_CHANGE 100
+		dst -= 0x2000 - PLANEWIDTH;
+		src += VIEWWINDOWWIDTH;
+	}
+#endif
+}
 
-static boolean refreshStatusBar;
-static uint8_t lcd = 0;
 
 void I_FinishUpdate(void)
 {
@@ -349,42 +224,26 @@ void I_FinishUpdate(void)
 	}
 
 	// view window
-	uint8_t *src = &_s_viewwindow[0];
-	uint8_t __far* dst = videomemory_view;
-
-	for (uint_fast8_t y = 0; y < VIEWWINDOWHEIGHT / 2; y++) {
-		_fmemcpy(dst, src, VIEWWINDOWWIDTH);
-
-		dst += 0x2000;
-		src += VIEWWINDOWWIDTH;
-
-		_fmemcpy(dst, src, VIEWWINDOWWIDTH);
-
-		dst -= 0x2000 - PLANEWIDTH;
-		src += VIEWWINDOWWIDTH;
-	}
+#if defined RENDER_SKIP
+	if (viewwindowchanged)
+#endif
+		I_FinishViewWindow();
 
 	// status bar
-	if (refreshStatusBar)
+	for (int16_t i = 0; i < st_numdirtyrects; i++)
 	{
-		refreshStatusBar = false;
-
-		uint8_t __far* src = _s_statusbar;
-		dst = videomemory_statusbar;
-		for (uint_fast8_t y = 0; y < ST_HEIGHT / 2; y++) {
-			for (uint_fast8_t x = 0; x < (SCREENWIDTH * 2 / 8); x++) {
-				*dst++ = (VGA_TO_BW_LUT_3[*src++] | VGA_TO_BW_LUT_2[*src++] | VGA_TO_BW_LUT_1[*src++] | VGA_TO_BW_LUT_0[*src++]) ^ lcd;
-			}
+		const st_rect_t* r = &st_dirtyrects[i];
 
-			dst += 0x2000 - (SCREENWIDTH * 2 / 8);
+		// four pixels per byte
+		const int16_t x1 = r->x / 4;
+		const int16_t x2 = (r->x + r->w + 3) / 4;
 
-			for (uint_fast8_t x = 0; x < (SCREENWIDTH * 2 / 8); x++) {
-				*dst++ = (VGA_TO_BW_LUT_3b[*src++] | VGA_TO_BW_LUT_2b[*src++] | VGA_TO_BW_LUT_1b[*src++] | VGA_TO_BW_LUT_0b[*src++]) ^ lcd;
-			}
-
-			dst -= 0x2000 - (PLANEWIDTH - (SCREENWIDTH * 2 / 8));
-		}
+		// odd lines are in the second bank
+		for (int16_t y = r->y; y < r->y + r->h; y++)
+			I_ChunkyToPlanar(videomemory_statusbar + (y / 2) * PLANEWIDTH + (y & 1) * 0x2000 + x1, &_s_statusbar[y * SCREENWIDTH + x1 * 4], x2 - x1, y & 1, lcd);
 	}
+
+	st_numdirtyrects = 0;
 }
 
 
@@ -490,6 +349,7 @@ void R_DrawColumn(const draw_column_vars_t *dcvars)
 	{
 		_fmemcpy(nearcolormap, dcvars->colormap, 256);
 		nearcolormapoffset = L_FP_OFF(dcvars->colormap);
+		STAT_INC(colormaploads);
 	}
 
 	dest = &_s_viewwindow[(dcvars->yl * VIEWWINDOWWIDTH) + dcvars->x];
@@ -501,6 +361,80 @@ void R_DrawColumn(const draw_column_vars_t *dcvars)
 }
 
 
+#if defined WIDE_COLUMNS
+//
+// Draws the same column into width adjacent columns,
+// for runs of identical wall columns.
+//
+void R_DrawColumnWide(const draw_column_vars_t *dcvars, int16_t width)
+{
+	int16_t count = (dcvars->yh - dcvars->yl) + 1;
+
+	// Zero length, column does not exceed a pixel.
+	if (count <= 0)
+		return;
+
+	const uint8_t __far* src = dcvars->source;
+
+	if (nearcolormapoffset != L_FP_OFF(dcvars->colormap))
+	{
+		_fmemcpy(nearcolormap, dcvars->colormap, 256);
+		nearcolormapoffset = L_FP_OFF(dcvars->colormap);
+		STAT_INC(colormaploads);
+	}
+
+	uint8_t *dst = &_s_viewwindow[(dcvars->yl * VIEWWINDOWWIDTH) + dcvars->x];
+
+	const uint16_t fracstep = dcvars->fracstep;
+	uint16_t frac = (dcvars->texturemid >> COLEXTRABITS) + (dcvars->yl - CENTERY) * fracstep;
+
+	switch (width)
+	{
+		// x86 allows unaligned word writes,
+		// memcpy of a local word avoids type-punning _s_viewwindow.
+		case 2:
+			while (count--)
+			{
+				const uint8_t c = nearcolormap[src[frac>>COLBITS]];
+				const uint16_t c2 = c | (c << 8);
+				memcpy(dst, &c2, 2);
+				dst += VIEWWINDOWWIDTH;
+				frac += fracstep;
+			}
+			break;
+
+		case 4:
+			while (count--)
+			{
+				const uint8_t c = nearcolormap[src[frac>>COLBITS]];
+				const uint16_t c2 = c | (c << 8);
+#if defined _M_I86
+				memcpy(dst,     &c2, 2);
+				memcpy(dst + 2, &c2, 2);
+#else
+				const uint32_t c4 = c2 | ((uint32_t)c2 << 16);
+				memcpy(dst, &c4, 4);
+#endif
+				dst += VIEWWINDOWWIDTH;
+				frac += fracstep;
+			}
+			break;
+
+		default:
+			while (count--)
+			{
+				const uint8_t c = nearcolormap[src[frac>>COLBITS]];
+				for (int16_t i = 0; i < width; i++)
+					dst[i] = c;
+				dst += VIEWWINDOWWIDTH;
+				frac += fracstep;
+			}
+			break;
+	}
+}
+#endif
+
+
 void R_DrawColumnFlat(uint8_t col, const draw_column_vars_t *dcvars)
 {
 	int16_t count = (dcvars->yh - dcvars->yl) + 1;
@@ -562,6 +496,7 @@ void R_DrawFuzzColumn(const draw_column_vars_t *dcvars)
 	{
 		_fmemcpy(nearcolormap, &fullcolormap[6 * 256], 256);
 		nearcolormapoffset = L_FP_OFF(&fullcolormap[6 * 256]);
+		STAT_INC(colormaploads);
 	}
 
 	uint8_t *dest = &_s_viewwindow[(dc_yl * VIEWWINDOWWIDTH) + dcvars->x];
@@ -583,8 +518,6 @@ void R_DrawFuzzColumn(const draw_column_vars_t *dcvars)
 
 void V_DrawRaw(int16_t num, uint16_t offset)
 {
-	refreshStatusBar = true;
-
 	const uint8_t __far* lump = W_TryGetLumpByNum(num);
 
 	if (lump != NULL)
@@ -819,6 +752,6 @@ int main(int argc, const char * const * argv)
 		if (!stricmp("lcd", argv[i]))
 			lcd = 0xff;
 
-	D_DoomMain();
+	D_DoomMain(argc, argv);
 	return 0;
 }
@@ -33,12 +33,16 @@
 
 #include <stdarg.h>
 #include <stdint.h>
+#include <stdio.h>
+#include <string.h>
 
 #include "compiler.h"
 
 #include "d_main.h"
+#include "i_c2p.h"
 #include "i_system.h"
 #include "m_random.h"
+#include "m_stats.h"
 #include "r_defs.h"
 #include "v_video.h"
 #include "w_wad.h"
@@ -52,7 +56,7 @@
 
 extern const int16_t CENTERY;
 
-static uint8_t _s_viewwindow[VIEWWINDOWWIDTH * VIEWWINDOWHEIGHT];
+static uint8_t _s_viewwindow[VIEWWINDOWWIDTH * VIEWWINDOWHEIGHT] __attribute__ ((aligned (2)));
 static uint8_t *_s_statusbar;
 static uint8_t *videomemory_view;
 static uint8_t *videomemory_statusbar;
@@ -60,10 +64,12 @@ static uint8_t *videomemory_statusbar;
 
 void I_InitGraphics(void)
 {
-	videomemory_view      = qd.screenBits.baseAddr + ((PLANEWIDTH - VIEWWINDOWWIDTH)     / 2) + (((SCREENHEIGHT_MAC - SCREENHEIGHT * 2) / 2) * PLANEWIDTH);
+	videomemory_view      = qd.screenBits.baseAddr + ((PLANEWIDTH - viewwindowwidth)     / 2) + (((SCREENHEIGHT_MAC - SCREENHEIGHT * 2) / 2) * PLANEWIDTH);
 	videomemory_statusbar = qd.screenBits.baseAddr + ((PLANEWIDTH - SCREENWIDTH * 2 / 8) / 2) + (((SCREENHEIGHT_MAC - SCREENHEIGHT * 2) / 2) * PLANEWIDTH) + VIEWWINDOWHEIGHT * 2 * PLANEWIDTH;
 
 	_s_statusbar = Z_MallocStatic(SCREENWIDTH * ST_HEIGHT);
+
+	I_InitChunkyToPlanar();
 }
 
 
@@ -73,270 +79,122 @@ void I_SetPalette(int8_t pal)
 }
 
 
-#define B2 (0 << 0)
-#define B1 (1 << 0)
-#define B0 (3 << 0)
-
-static const uint8_t VGA_TO_BW_LUT_0[256] =
-{
-	B0, B0, B0, B1, B2, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B1, B1,
-	B1, B1, B1, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2,
-	B2, B1, B1, B1, B1, B1, B1, B1, B1, B1, B1, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2,
-	B1, B1, B1, B1, B1, B1, B1, B1, B1, B1, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B1, B1, B1, B1, B1,
-	B1, B1, B1, B1, B1, B1, B0, B0, B1, B1, B1, B1, B1, B1, B0, B0,
-	B2, B2, B2, B2, B1, B1, B1, B0, B2, B2, B2, B2, B2, B2, B1, B1,
-	B1, B1, B1, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B1, B1, B1, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B1,
-	B2, B2, B2, B2, B2, B2, B2, B2, B1, B1, B1, B0, B0, B0, B0, B0,
-	B0, B0, B0, B0, B0, B0, B0, B0, B2, B2, B2, B1, B1, B0, B0, B1
-};
-
-#undef B0
-#undef B1
-#undef B2
 
-#define B2 (0 << 0)
-#define B1 (2 << 0)
-#define B0 (3 << 0)
 
-static const uint8_t VGA_TO_BW_LUT_0b[256] =
-{
-	B0, B0, B0, B1, B2, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B1, B1,
-	B1, B1, B1, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2,
-	B2, B1, B1, B1, B1, B1, B1, B1, B1, B1, B1, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2,
-	B1, B1, B1, B1, B1, B1, B1, B1, B1, B1, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B1, B1, B1, B1, B1,
-	B1, B1, B1, B1, B1, B1, B0, B0, B1, B1, B1, B1, B1, B1, B0, B0,
-	B2, B2, B2, B2, B1, B1, B1, B0, B2, B2, B2, B2, B2, B2, B1, B1,
-	B1, B1, B1, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B1, B1, B1, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B1,
-	B2, B2, B2, B2, B2, B2, B2, B2, B1, B1, B1, B0, B0, B0, B0, B0,
-	B0, B0, B0, B0, B0, B0, B0, B0, B2, B2, B2, B1, B1, B0, B0, B1
-};
+#if defined DIRTY_SPANS
+#if VIEWWINDOWWIDTH % 2 != 0
+#error DIRTY_SPANS needs an even VIEWWINDOWWIDTH
+#endif
 
-#undef B0
-#undef B1
-#undef B2
+// The view window as it was last copied to video memory
+static uint16_t presentedview[VIEWWINDOWWIDTH * VIEWWINDOWHEIGHT / 2];
+static boolean presentall = true;
 
-#define B2 (0 << 2)
-#define B1 (1 << 2)
-#define B0 (3 << 2)
 
-static const uint8_t VGA_TO_BW_LUT_1[256] =
+static uint16_t I_ViewWord(const uint8_t *src, int16_t i)
 {
-	B0, B0, B0, B1, B2, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B1, B1,
-	B1, B1, B1, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2,
-	B2, B1, B1, B1, B1, B1, B1, B1, B1, B1, B1, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2,
-	B1, B1, B1, B1, B1, B1, B1, B1, B1, B1, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B1, B1, B1, B1, B1,
-	B1, B1, B1, B1, B1, B1, B0, B0, B1, B1, B1, B1, B1, B1, B0, B0,
-	B2, B2, B2, B2, B1, B1, B1, B0, B2, B2, B2, B2, B2, B2, B1, B1,
-	B1, B1, B1, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B1, B1, B1, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B1,
-	B2, B2, B2, B2, B2, B2, B2, B2, B1, B1, B1, B0, B0, B0, B0, B0,
-	B0, B0, B0, B0, B0, B0, B0, B0, B2, B2, B2, B1, B1, B0, B0, B1
-};
-
-#undef B0
-#undef B1
-#undef B2
+	uint16_t w;
+	memcpy(&w, src + i * 2, 2);
+	return w;
+}
 
-#define B2 (0 << 2)
-#define B1 (2 << 2)
-#define B0 (3 << 2)
 
-static const uint8_t VGA_TO_BW_LUT_1b[256] =
+//
+// Copy only the changed part of a view window row to both screen lines.
+// The changed span is found a word at a time from both ends of the row.
+//
+static void I_PresentRow(uint8_t *dst, const uint8_t *src, uint16_t *presented)
 {
-	B0, B0, B0, B1, B2, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B1, B1,
-	B1, B1, B1, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2,
-	B2, B1, B1, B1, B1, B1, B1, B1, B1, B1, B1, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2,
-	B1, B1, B1, B1, B1, B1, B1, B1, B1, B1, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B1, B1, B1, B1, B1,
-	B1, B1, B1, B1, B1, B1, B0, B0, B1, B1, B1, B1, B1, B1, B0, B0,
-	B2, B2, B2, B2, B1, B1, B1, B0, B2, B2, B2, B2, B2, B2, B1, B1,
-	B1, B1, B1, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B1, B1, B1, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B1,
-	B2, B2, B2, B2, B2, B2, B2, B2, B1, B1, B1, B0, B0, B0, B0, B0,
-	B0, B0, B0, B0, B0, B0, B0, B0, B2, B2, B2, B1, B1, B0, B0, B1
-};
+	int16_t first = 0;
+	int16_t last  = (viewwindowwidth - 1) / 2;
 
-#undef B0
-#undef B1
-#undef B2
+	while (first <= last && I_ViewWord(src, first) == presented[first])
+		first++;
 
-#define B2 (0 << 4)
-#define B1 (1 << 4)
-#define B0 (3 << 4)
+	if (first > last)
+		return;
 
-static const uint8_t VGA_TO_BW_LUT_2[256] =
-{
-	B0, B0, B0, B1, B2, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B1, B1,
-	B1, B1, B1, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2,
-	B2, B1, B1, B1, B1, B1, B1, B1, B1, B1, B1, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2,
-	B1, B1, B1, B1, B1, B1, B1, B1, B1, B1, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B1, B1, B1, B1, B1,
-	B1, B1, B1, B1, B1, B1, B0, B0, B1, B1, B1, B1, B1, B1, B0, B0,
-	B2, B2, B2, B2, B1, B1, B1, B0, B2, B2, B2, B2, B2, B2, B1, B1,
-	B1, B1, B1, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B1, B1, B1, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B1,
-	B2, B2, B2, B2, B2, B2, B2, B2, B1, B1, B1, B0, B0, B0, B0, B0,
-	B0, B0, B0, B0, B0, B0, B0, B0, B2, B2, B2, B1, B1, B0, B0, B1
-};
+	while (I_ViewWord(src, last) == presented[last])
+		last--;
 
-#undef B0
-#undef B1
-#undef B2
+	memcpy(presented + first, src + first * 2, (last - first + 1) * 2);
 
-#define B2 (0 << 4)
-#define B1 (2 << 4)
-#define B0 (3 << 4)
+	int16_t x1 = first * 2;
+	int16_t x2 = last  * 2 + 2;
+	if (x2 > viewwindowwidth)
+		x2 = viewwindowwidth;
 
-static const uint8_t VGA_TO_BW_LUT_2b[256] =
-{
-	B0, B0, B0, B1, B2, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B1, B1,
-	B1, B1, B1, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2,
-	B2, B1, B1, B1, B1, B1, B1, B1, B1, B1, B1, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2,
-	B1, B1, B1, B1, B1, B1, B1, B1, B1, B1, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B1, B1, B1, B1, B1,
-	B1, B1, B1, B1, B1, B1, B0, B0, B1, B1, B1, B1, B1, B1, B0, B0,
-	B2, B2, B2, B2, B1, B1, B1, B0, B2, B2, B2, B2, B2, B2, B1, B1,
-	B1, B1, B1, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B1, B1, B1, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B1,
-	B2, B2, B2, B2, B2, B2, B2, B2, B1, B1, B1, B0, B0, B0, B0, B0,
-	B0, B0, B0, B0, B0, B0, B0, B0, B2, B2, B2, B1, B1, B0, B0, B1
-};
-
-#undef B0
-#undef B1
-#undef B2
+	BlockMoveData(src + x1, dst + x1,              x2 - x1);
+	BlockMoveData(src + x1, dst + x1 + PLANEWIDTH, x2 - x1);
+	STAT_ADD(presentedbytes, (x2 - x1) * 2);
+}
+#endif
 
-#define B2 (0 << 6)
-#define B1 (1 << 6)
-#define B0 (3 << 6)
 
-static const uint8_t VGA_TO_BW_LUT_3[256] =
+static void I_FinishViewWindow(void)
 {
-	B0, B0, B0, B1, B2, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B1, B1,
-	B1, B1, B1, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2,
-	B2, B1, B1, B1, B1, B1, B1, B1, B1, B1, B1, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2,
-	B1, B1, B1, B1, B1, B1, B1, B1, B1, B1, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B1, B1, B1, B1, B1,
-	B1, B1, B1, B1, B1, B1, B0, B0, B1, B1, B1, B1, B1, B1, B0, B0,
-	B2, B2, B2, B2, B1, B1, B1, B0, B2, B2, B2, B2, B2, B2, B1, B1,
-	B1, B1, B1, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B1, B1, B1, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B1,
-	B2, B2, B2, B2, B2, B2, B2, B2, B1, B1, B1, B0, B0, B0, B0, B0,
-	B0, B0, B0, B0, B0, B0, B0, B0, B2, B2, B2, B1, B1, B0, B0, B1
-};
+	uint8_t *src = &_s_viewwindow[0];
+	uint8_t *dst = videomemory_view;
 
-#undef B0
-#undef B1
-#undef B2
+#if defined DIRTY_SPANS
+	uint16_t *presented = presentedview;
 
-#define B2 (0 << 6)
-#define B1 (2 << 6)
-#define B0 (3 << 6)
+	if (presentall)
+	{
+		// make every word differ, so the first frame is copied completely
+		presentall = false;
+		memcpy(presentedview, _s_viewwindow, sizeof(presentedview));
+		for (uint16_t i = 0; i < VIEWWINDOWWIDTH * VIEWWINDOWHEIGHT / 2; i++)
+			presentedview[i] = ~presentedview[i];
+	}
 
-static const uint8_t VGA_TO_BW_LUT_3b[256] =
-{
-	B0, B0, B0, B1, B2, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B1, B1,
-	B1, B1, B1, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2,
-	B2, B1, B1, B1, B1, B1, B1, B1, B1, B1, B1, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2, B2,
-	B1, B1, B1, B1, B1, B1, B1, B1, B1, B1, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B1, B1, B1, B1, B1,
-	B1, B1, B1, B1, B1, B1, B0, B0, B1, B1, B1, B1, B1, B1, B0, B0,
-	B2, B2, B2, B2, B1, B1, B1, B0, B2, B2, B2, B2, B2, B2, B1, B1,
-	B1, B1, B1, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B1, B1, B1, B0, B0, B0, B0, B0, B0, B0, B0, B0,
-	B2, B2, B2, B2, B2, B2, B2, B2, B2, B1, B1, B1, B1, B1, B1, B1,
-	B2, B2, B2, B2, B2, B2, B2, B2, B1, B1, B1, B0, B0, B0, B0, B0,
-	B0, B0, B0, B0, B0, B0, B0, B0, B2, B2, B2, B1, B1, B0, B0, B1
-};
+	for (uint_fast8_t y = 0; y < VIEWWINDOWHEIGHT; y++) {
+		I_PresentRow(dst, src, presented);
 
-#undef B0
-#undef B1
-#undef B2
+		dst       += PLANEWIDTH * 2;
+		src       += VIEWWINDOWWIDTH;
+		presented += VIEWWINDOWWIDTH / 2;
+	}
+#else
+	for (uint_fast8_t y = 0; y < VIEWWINDOWHEIGHT; y++) {
+		BlockMoveData(src, dst,              viewwindowwidth);
+		BlockMoveData(src, dst + PLANEWIDTH, viewwindowwidth);
 
+		dst += PLANEWIDTH * 2;
+		src += VIEWWINDOWWIDTH;
+	}
+#endif
+}
 
-static boolean refreshStatusBar;
 
 void I_FinishUpdate(void)
 {
 	// view window
-	uint8_t *src = &_s_viewwindow[0];
-	uint8_t *dst = videomemory_view;
-
-	for (uint_fast8_t y = 0; y < VIEWWINDOWHEIGHT; y++) {
-		BlockMoveData(src, dst,              VIEWWINDOWWIDTH);
-		BlockMoveData(src, dst + PLANEWIDTH, VIEWWINDOWWIDTH);
-
-		dst += PLANEWIDTH * 2;
-		src += VIEWWINDOWWIDTH;
-	}
+#if defined RENDER_SKIP
+	if (viewwindowchanged)
+#endif
+		I_FinishViewWindow();
 
 	// status bar
-	if (refreshStatusBar)
+	for (int16_t i = 0; i < st_numdirtyrects; i++)
 	{
-		refreshStatusBar = false;
-
-		src = _s_statusbar;
-		dst = videomemory_statusbar;
-		for (uint_fast8_t y = 0; y < ST_HEIGHT; y++) {
-			for (uint_fast8_t x = 0; x < (SCREENWIDTH * 2 / 8); x++) {
-				uint8_t s1 = *src++;
-				uint8_t s2 = *src++;
-				uint8_t s3 = *src++;
-				uint8_t s4 = *src++;
-				uint8_t b  = VGA_TO_BW_LUT_3[s1]  | VGA_TO_BW_LUT_2[s2]  | VGA_TO_BW_LUT_1[s3]  | VGA_TO_BW_LUT_0[s4];
-				uint8_t bb = VGA_TO_BW_LUT_3b[s1] | VGA_TO_BW_LUT_2b[s2] | VGA_TO_BW_LUT_1b[s3] | VGA_TO_BW_LUT_0b[s4];
-				*dst                = b;
-				*(dst + PLANEWIDTH) = bb;
-				dst++;
-			}
+		const st_rect_t* r = &st_dirtyrects[i];
+
+		// four pixels per byte
+		const int16_t x1 = r->x / 4;
+		const int16_t x2 = (r->x + r->w + 3) / 4;
+
+		for (int16_t y = r->y; y < r->y + r->h; y++) {
+			const uint8_t *src = &_s_statusbar[y * SCREENWIDTH + x1 * 4];
+			uint8_t *dst = videomemory_statusbar + y * PLANEWIDTH * 2 + x1;
 
-			dst += PLANEWIDTH * 2 - (SCREENWIDTH * 2 / 8);
+			// black is a set bit, so the dither pattern is inverted
+			I_ChunkyToPlanar(dst,              src, x2 - x1, 1, 0xff);
+			I_ChunkyToPlanar(dst + PLANEWIDTH, src, x2 - x1, 0, 0xff);
 		}
 	}
+
+	st_numdirtyrects = 0;
 }
 
 
@@ -420,6 +278,65 @@ void R_DrawColumn(const draw_column_vars_t *dcvars)
 }
 
 
+#if defined WIDE_COLUMNS
+//
+// Draws the same column into width adjacent columns,
+// for runs of identical wall columns.
+//
+void R_DrawColumnWide(const draw_column_vars_t *dcvars, int16_t width)
+{
+	int16_t count = (dcvars->yh - dcvars->yl) + 1;
+
+	// Zero length, column does not exceed a pixel.
+	if (count <= 0)
+		return;
+
+	const uint8_t *src = dcvars->source;
+
+	const uint8_t *nearcolormap = dcvars->colormap;
+
+	uint8_t *dst = &_s_viewwindow[(dcvars->yl * VIEWWINDOWWIDTH) + dcvars->x];
+
+	const uint16_t fracstep = dcvars->fracstep;
+	uint16_t frac = (dcvars->texturemid >> COLEXTRABITS) + (dcvars->yl - CENTERY) * fracstep;
+
+	switch (width)
+	{
+		case 2:
+			while (count--)
+			{
+				const uint8_t c = nearcolormap[src[frac>>COLBITS]];
+				dst[0] = dst[1] = c;
+				dst += VIEWWINDOWWIDTH;
+				frac += fracstep;
+			}
+			break;
+
+		case 4:
+			while (count--)
+			{
+				const uint8_t c = nearcolormap[src[frac>>COLBITS]];
+				dst[0] = dst[1] = dst[2] = dst[3] = c;
+				dst += VIEWWINDOWWIDTH;
+				frac += fracstep;
+			}
+			break;
+
+		default:
+			while (count--)
+			{
+				const uint8_t c = nearcolormap[src[frac>>COLBITS]];
+				for (int16_t i = 0; i < width; i++)
+					dst[i] = c;
+				dst += VIEWWINDOWWIDTH;
+				frac += fracstep;
+			}
+			break;
+	}
+}
+#endif
+
+
 void R_DrawColumnFlat(uint8_t col, const draw_column_vars_t *dcvars)
 {
 	int16_t count = (dcvars->yh - dcvars->yl) + 1;
@@ -498,8 +415,6 @@ void R_DrawFuzzColumn(const draw_column_vars_t *dcvars)
 
 void V_DrawRaw(int16_t num, uint16_t offset)
 {
-	refreshStatusBar = true;
-
 	const uint8_t *lump = W_TryGetLumpByNum(num);
 
 	if (lump != NULL)
@@ -608,8 +523,9 @@ void I_Error2(const char *error, ...)
 	va_list argptr;
 	Str255 pstr;
 
+	// with -DSTATISTICS the timedemo message is longer than a Str255
 	va_start(argptr, error);
-	vsprintf(pstr, error, argptr);
+	vsnprintf(pstr, sizeof(pstr), error, argptr);
 	va_end(argptr);
 
 	SetRect(&r, 10, 10, 10 + StringWidth(pstr) + 10, 30);
@@ -646,7 +562,7 @@ int main(void)
 
 	EraseRect(&r);
 
-	D_DoomMain();
+	D_DoomMain(0, NULL);
 
 	return 0;
 }
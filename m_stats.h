@@ -0,0 +1,63 @@
+//
+//
+// Copyright (C) 2026 Frenkel Smeijers
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+// DESCRIPTION:
+//  Optional counters, reported per gametic at the end of a timedemo.
+//  Compile with -DSTATISTICS to enable them.
+//
+
+#ifndef __M_STATS__
+#define __M_STATS__
+
+#include <stdint.h>
+
+#if defined STATISTICS
+
+typedef struct
+{
+	uint32_t bspnodes;		// R_RenderBSPNode calls
+	uint32_t presentedbytes;	// view window bytes written to video memory
+	uint32_t droppedsprites;	// vissprites that didn't fit in MAXVISSPRITES
+	uint32_t skippedframes;		// frames not rendered by RENDER_SKIP
+	uint32_t colormaploads;		// colormaps copied to near memory by R_DrawColumn
+	uint32_t interceptoverflows;	// traces that had more than MAXINTERCEPTS intercepts
+	uint32_t sightchecks;		// P_CheckSight calls
+	uint32_t sightrejects;		// P_CheckSight calls rejected by the REJECT table
+	uint32_t sighthits;		// P_CheckSight calls answered by SIGHT_CACHE
+	uint32_t secnodeshighwater;	// most sector nodes in use at the same time
+	uint32_t secnodeoverflows;	// sector nodes that didn't fit in MAX_MSECNODES
+	uint32_t thinkers;		// thinkers visited by P_RunThinkers
+	uint32_t positionchecks;	// P_CheckPosition calls
+	uint32_t linechecks;		// PIT_CheckLine calls
+	uint32_t thingchecks;		// PIT_CheckThing calls
+} statistics_t;
+
+extern statistics_t _g_statistics;
+
+#define STAT_INC(counter)	_g_statistics.counter++
+#define STAT_ADD(counter,n)	_g_statistics.counter += (n)
+#define STAT_MAX(counter,n)	do { if (_g_statistics.counter < (n)) _g_statistics.counter = (n); } while (0)
+
+#else
+
+#define STAT_INC(counter)	((void)0)
+#define STAT_ADD(counter,n)	((void)0)
+#define STAT_MAX(counter,n)	((void)0)
+
+#endif
+
+#endif
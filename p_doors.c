@@ -67,13 +67,13 @@ static void EV_LightTurnOnPartway(const line_t __far* line, fixed_t level)
   // search all sectors for ones with same tag as activating line
   for (i = -1; (i = P_FindSectorFromLineTag(line,i)) >= 0;)
     {
-      sector_t __far* temp;
+      const sector_t __far* temp;
       sector_t __far* sector = _g_sectors+i;
       int16_t j, bright = 0, min = sector->lightlevel;
 
-      for (j = 0; j < sector->linecount; j++)
-  if ((temp = getNextSector(sector->lines[j],sector)))
+      for (j = 0; j < sector->neighbourcount; j++)
     {
+      temp = sector->neighbours[j].sector;
       if (temp->lightlevel > bright)
         bright = temp->lightlevel;
       if (temp->lightlevel < min)
@@ -82,6 +82,7 @@ static void EV_LightTurnOnPartway(const line_t __far* line, fixed_t level)
 
       sector->lightlevel =   // Set level in-between extremes
   (level * bright + (FRACUNIT-level) * min) >> FRACBITS;
+      R_SectorChanged(sector);
     }
 }
 
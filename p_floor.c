@@ -162,6 +162,9 @@ static boolean P_CheckSector(sector_t __far* sector)
   {
   msecnode_t *n;
 
+  R_SectorChanged(sector);
+  P_ClearSightCache();
+
   nofit = false;
 
   // killough 4/4/98: scan list front-to-back until empty or exhausted,
@@ -398,6 +401,7 @@ static void T_MoveFloor(floormove_t __far* floor)
         case donutRaise:
           floor->sector->special  = 0;
           floor->sector->floorpic = floor->texture;
+          R_SectorChanged(floor->sector);
           break;
         default:
           break;
@@ -423,17 +427,15 @@ static void T_MoveFloor(floormove_t __far* floor)
 fixed_t P_FindNextHighestFloor(sector_t __far* sec)
 {
   fixed_t currentheight = sec->floorheight;
-  sector_t __far* other;
+  const sector_t __far* other;
   int16_t i;
 
-  for (i=0 ;i < sec->linecount ; i++)
-    if ((other = getNextSector(sec->lines[i],sec)) &&
-         other->floorheight > currentheight)
+  for (i=0 ;i < sec->neighbourcount ; i++)
+    if ((other = sec->neighbours[i].sector)->floorheight > currentheight)
     {
       fixed_t height = other->floorheight;
-      while (++i < sec->linecount)
-        if ((other = getNextSector(sec->lines[i],sec)) &&
-            other->floorheight < height &&
+      while (++i < sec->neighbourcount)
+        if ((other = sec->neighbours[i].sector)->floorheight < height &&
             other->floorheight > currentheight)
           height = other->floorheight;
       return height;
@@ -87,6 +87,7 @@ static void T_LightFlash (lightflash_t __far* flash)
     flash->count = (P_Random()&flash->maxtime)+1;
   }
 
+  R_SectorChanged(flash->sector);
 }
 
 //
@@ -125,6 +126,8 @@ static void T_StrobeFlash (strobe_t __far*   flash)
     flash-> sector->lightlevel = flash->minlight;
     flash->count =flash->darktime;
   }
+
+  R_SectorChanged(flash->sector);
 }
 
 //
@@ -169,6 +172,8 @@ static void T_Glow(glow_t __far* g)
       }
       break;
   }
+
+  R_SectorChanged(g->sector);
 }
 
 
@@ -183,17 +188,12 @@ static int16_t P_FindMinSurroundingLight(sector_t __far* sector, int16_t max)
 {
   int16_t         i;
   int16_t         min;
-  const line_t __far*     line;
-  sector_t __far*   check;
+  const sector_t __far*   check;
 
   min = max;
-  for (i=0 ; i < sector->linecount ; i++)
+  for (i=0 ; i < sector->neighbourcount ; i++)
   {
-    line = sector->lines[i];
-    check = getNextSector(line,sector);
-
-    if (!check)
-      continue;
+    check = sector->neighbours[i].sector;
 
     if (check->lightlevel < min)
       min = check->lightlevel;
@@ -46,6 +46,7 @@
 #include "p_user.h"
 #include "m_random.h"
 #include "i_system.h"
+#include "m_stats.h"
 
 #include "globdata.h"
 
@@ -140,6 +141,8 @@ static boolean untouched(const line_t __far* ld)
 
 static boolean PIT_CheckLine (line_t __far* ld)
 {
+  STAT_INC(linechecks);
+
   if (_g_tmbbox[BOXRIGHT]  <= (fixed_t)ld->bbox[BOXLEFT]   << FRACBITS
    || _g_tmbbox[BOXLEFT]   >= (fixed_t)ld->bbox[BOXRIGHT]  << FRACBITS
    || _g_tmbbox[BOXTOP]    <= (fixed_t)ld->bbox[BOXBOTTOM] << FRACBITS
@@ -223,6 +226,8 @@ static boolean PIT_CheckThing(mobj_t __far* thing)
   fixed_t blockdist;
   int16_t damage;
 
+  STAT_INC(thingchecks);
+
   // killough 11/98: add touchy things
   if (!(thing->flags & (MF_SOLID|MF_SPECIAL|MF_SHOOTABLE)))
     return true;
@@ -347,6 +352,8 @@ boolean P_CheckPosition(mobj_t __far* thing, fixed_t x, fixed_t y)
   int16_t     by;
   subsector_t __far*  newsubsec;
 
+  STAT_INC(positionchecks);
+
   tmthing = thing;
 
   tmx = x;
@@ -983,31 +990,62 @@ void P_RadiusAttack(mobj_t __far* spot, mobj_t __far* source, int16_t damage)
 
 // CPhipps -
 // Use block memory allocator here
+// Free nodes are linked through m_tnext.
 
+#if !defined MAX_MSECNODES
 #define MAX_MSECNODES 318
+#endif
 
-static byte used[MAX_MSECNODES];
 static msecnode_t msecnodes[MAX_MSECNODES];
+static msecnode_t *freesecnodes;
 
+#if defined STATISTICS
+static uint16_t usedsecnodes;
+#endif
 
-enum { unused_block = 0, used_block = 1};
+
+void P_InitSecnodes(void)
+{
+	freesecnodes = NULL;
+	for (int16_t i = MAX_MSECNODES - 1; i >= 0; i--)
+	{
+		msecnodes[i].m_tnext = freesecnodes;
+		freesecnodes = &msecnodes[i];
+	}
+
+#if defined STATISTICS
+	usedsecnodes = 0;
+#endif
+}
 
 
 inline static msecnode_t* P_GetSecnode(void)
 {
-	byte* b = memchr(&used[0], unused_block, MAX_MSECNODES);
-	int16_t i = b - &used[0];
-
-	used[i] = used_block;
-	return &msecnodes[i];
+	msecnode_t* node = freesecnodes;
+
+	if (node)
+	{
+		freesecnodes = node->m_tnext;
+#if defined STATISTICS
+		usedsecnodes++;
+		STAT_MAX(secnodeshighwater, usedsecnodes);
+#endif
+	}
+	else
+		STAT_INC(secnodeoverflows);
+
+	return node;
 }
 
 // P_PutSecnode() returns a node to the freelist.
 
 inline static void P_PutSecnode(msecnode_t* node)
 {
-	int16_t i = node - &msecnodes[0];
-	used[i] = unused_block;
+	node->m_tnext = freesecnodes;
+	freesecnodes = node;
+#if defined STATISTICS
+	usedsecnodes--;
+#endif
 }
 
 // phares 3/16/98
@@ -1035,7 +1073,12 @@ static void P_AddSecnode(sector_t __far* s, mobj_t __far* thing)
   // Couldn't find an existing node for this sector. Add one at the head
   // of the list.
 
+  // When the pool is exhausted the thing is left out of this sector's
+  // thinglist, so only a moving plane in s will overlook it.
+
   node = P_GetSecnode();
+  if (!node)
+    return;
 
   // killough 4/4/98, 4/7/98: mark new nodes unvisited.
   node->visited = false;
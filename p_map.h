@@ -48,6 +48,11 @@ boolean P_IsAttackRangeMeleeRange(void);
 boolean P_TryMove(mobj_t __far* thing, fixed_t x, fixed_t y);
 
 boolean P_CheckSight(mobj_t __far* t1, mobj_t __far* t2);
+#if defined SIGHT_CACHE
+void    P_ClearSightCache(void);
+#else
+#define P_ClearSightCache()	((void)0)
+#endif
 void    P_UseLines(player_t *player);
 
 fixed_t P_AimLineAttack(mobj_t __far*t1, angle_t angle, fixed_t distance);
@@ -57,6 +62,7 @@ void    P_RadiusAttack(mobj_t __far* spot, mobj_t __far* source, int16_t damage)
 boolean P_CheckPosition(mobj_t __far* thing, fixed_t x, fixed_t y);
 
 
+void    P_InitSecnodes(void);
 void    P_DelSeclist(void);
 void    P_SetSeclist(msecnode_t* seclist);
 void    P_CreateSecNodeList(mobj_t __far* thing);
@@ -41,6 +41,7 @@
 #include "p_maputl.h"
 #include "p_map.h"
 #include "p_setup.h"
+#include "m_stats.h"
 
 #include "globdata.h"
 
@@ -449,14 +450,12 @@ boolean P_BlockLinesIterator(int16_t x, int16_t y, boolean func(line_t __far*))
     {
         const int16_t lineno = *list;
 
-        line_t __far* ld = &_g_lines[lineno];
-
-        if (ld->validcount == vcount)
+        if (_g_linevalidcounts[lineno] == vcount)
             continue;       // line has already been checked
 
-        ld->validcount = vcount;
+        _g_linevalidcounts[lineno] = vcount;
 
-        if (!func(ld))
+        if (!func(&_g_lines[lineno]))
             return false;
     }
 
@@ -486,7 +485,32 @@ static boolean check_intercept(void)
 {
     size_t offset = intercept_p - intercepts;
 
-    return (offset < MAXINTERCEPTS);
+    if (offset < MAXINTERCEPTS)
+        return true;
+
+    STAT_INC(interceptoverflows);
+    return false;
+}
+
+
+//
+// P_NewIntercept
+// The intercepts are kept sorted on frac.
+// Intercepts with the same frac stay in the order they were added,
+// so they are traversed in the same order as by a nearest-first search.
+//
+static intercept_t* P_NewIntercept(fixed_t frac)
+{
+    intercept_t* in = intercept_p++;
+
+    while (in > intercepts && (in - 1)->frac > frac)
+    {
+        *in = *(in - 1);
+        in--;
+    }
+
+    in->frac = frac;
+    return in;
 }
 
 
@@ -533,10 +557,9 @@ static boolean PIT_AddLineIntercepts(line_t __far* ld)
   if(!check_intercept())
     return false;
 
-  intercept_p->frac = frac;
-  intercept_p->isaline = true;
-  intercept_p->d.line = ld;
-  intercept_p++;
+  intercept_t* in = P_NewIntercept(frac);
+  in->isaline = true;
+  in->d.line = ld;
 
   return true;  // continue
 }
@@ -589,10 +612,9 @@ static boolean PIT_AddThingIntercepts(mobj_t __far* thing)
   if(!check_intercept())
       return false;
 
-  intercept_p->frac = frac;
-  intercept_p->isaline = false;
-  intercept_p->d.thing = thing;
-  intercept_p++;
+  intercept_t* in = P_NewIntercept(frac);
+  in->isaline = false;
+  in->d.thing = thing;
 
   return true;          // keep going
 }
@@ -605,20 +627,12 @@ static boolean PIT_AddThingIntercepts(mobj_t __far* thing)
 
 static boolean P_TraverseIntercepts(traverser_t func, fixed_t maxfrac)
 {
-  intercept_t *in = NULL;
-  int16_t count = intercept_p - intercepts;
-  while (count--)
+  for (intercept_t *in = intercepts; in < intercept_p; in++)
     {
-      fixed_t dist = INT32_MAX;
-      intercept_t *scan;
-      for (scan = intercepts; scan < intercept_p; scan++)
-        if (scan->frac < dist)
-          dist = (in=scan)->frac;
-      if (dist > maxfrac)
+      if (in->frac > maxfrac)
         return true;    // checked everything in range
       if (!func(in))
         return false;           // don't bother going farther
-      in->frac = INT32_MAX;
     }
   return true;                  // everything was traversed
 }
@@ -719,7 +733,7 @@ boolean P_PathTraverse(fixed_t x1, fixed_t y1, fixed_t x2, fixed_t y2,
   mapx = xt1;
   mapy = yt1;
 
-  for (count = 0; count < 24; count++)
+  for (count = 0; count < 24 * 128 / MAPBLOCKUNITS; count++)
     {
       if (flags & PT_ADDLINES)
         if (!P_BlockLinesIterator(mapx, mapy,PIT_AddLineIntercepts))
@@ -39,9 +39,17 @@
 #include "r_defs.h"
 
 /* mapblocks are used to check movement against lines and things */
+#if defined FINE_BLOCKMAP
+/* P_LoadBlockMap builds a blockmap of 64 units instead of using the lump.
+ * The checks see lines and things in a different order, so demos recorded
+ * with the lump's blockmap can go out of sync. */
+#define MAPBLOCKUNITS   64
+#define MAPBTOFRAC      6
+#else
 #define MAPBLOCKUNITS   128
-#define MAPBLOCKSIZE    (MAPBLOCKUNITS*FRACUNIT)
 #define MAPBTOFRAC      7
+#endif
+#define MAPBLOCKSIZE    (MAPBLOCKUNITS*FRACUNIT)
 #define MAPBLOCKSHIFT   (FRACBITS+MAPBTOFRAC)
 
 #define PT_ADDLINES     1
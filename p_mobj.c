@@ -88,6 +88,9 @@ boolean P_SetMobjState(mobj_t __far* mobj, statenum_t state)
 
     } while (!mobj->tics);
 
+    if ((mobj->flags & MF_SLEEPING) && mobj->tics != -1 && mobj->thinker.function)
+        P_WakeMobj(mobj);
+
     return true;
 }
 
@@ -669,7 +672,8 @@ static void P_MobjBrainlessThinker(mobj_t __far* mobj)
         // you can cycle through multiple states in a tic
 
         if (!mobj->tics)
-            P_SetMobjState (mobj, mobj->state->nextstate);
+            if (P_SetMobjState (mobj, mobj->state->nextstate) && mobj->tics == -1)
+                P_SleepMobj(mobj);
     }
 }
 
@@ -689,32 +693,55 @@ static think_t P_ThinkerFunctionForType(mobjtype_t type, mobj_t __far* mobj)
     return NULL;
 }
 
+//
+// Mobj allocation
+// Free mobjs are linked through thinker.next. The list starts with the
+// thing pool of the level and grows by a slab of MOBJSLABSIZE mobjs
+// whenever it runs out. Slabs are freed with the rest of the level.
+//
+
+#define MOBJSLABSIZE 8
+
+static mobj_t __far* freemobjs;
+
+
+void P_InitMobjPool(void)
+{
+    freemobjs = NULL;
+
+    for (int16_t i = 0; i < _g_thingPoolSize; i++)
+        P_FreeMobj(&_g_thingPool[i]);
+}
+
+
+void P_FreeMobj(mobj_t __far* mobj)
+{
+    mobj->type = MT_NOTHING;
+    mobj->thinker.next = &freemobjs->thinker;
+    freemobjs = mobj;
+}
+
+
 //
 // P_SpawnMobj
 //
 
 static mobj_t __far* P_NewMobj()
 {
-    mobj_t __far* mobj = NULL;
+    mobj_t __far* mobj;
 
-    for(int16_t i = _g_thingPoolSize-1; i >= 0; i--)
+    if (freemobjs == NULL)
     {
-        if(_g_thingPool[i].type == MT_NOTHING)
-        {
-            mobj = &_g_thingPool[i];
-            _fmemset (mobj, 0, sizeof (*mobj));
+        mobj_t __far* slab = Z_MallocLevel(MOBJSLABSIZE * sizeof(mobj_t), NULL);
 
-            mobj->pooled = true;
-            return mobj;
-        }
+        for (int16_t i = 0; i < MOBJSLABSIZE; i++)
+            P_FreeMobj(&slab[i]);
     }
 
-    if(mobj == NULL)
-    {
-        mobj = Z_MallocLevel(sizeof(*mobj), NULL);
-        _fmemset (mobj, 0, sizeof (*mobj));
-    }
+    mobj = freemobjs;
+    freemobjs = (mobj_t __far*)mobj->thinker.next;
 
+    _fmemset (mobj, 0, sizeof (*mobj));
     return mobj;
 }
 
@@ -763,6 +790,9 @@ mobj_t __far* P_SpawnMobj(fixed_t x,fixed_t y,fixed_t z,mobjtype_t type)
 
     mobj->target = mobj->lastenemy = NULL;
     P_AddThinker (&mobj->thinker);
+    if (!mobj->thinker.function)
+        P_SleepMobj(mobj);
+
     return mobj;
 }
 
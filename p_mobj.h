@@ -163,6 +163,8 @@
 // Don't stop moving halfway off a step,
 //  that is, have dead bodies slide down all the way.
 #define MF_CORPSE       0x4000U
+// On the sleeping thinker list, see P_SleepMobj.
+#define MF_SLEEPING     0x8000U
 
 
 // Map Object definition.
@@ -189,11 +191,28 @@ typedef struct mobj_s
     // List: thinker links.
     thinker_t           thinker;
 
+    // The fields P_MobjThinker reads every tic come first,
+    // so an idle mobj costs as few cache lines as possible.
+
+    // Momentums, used to update position.
+    fixed_t             momx;
+    fixed_t             momy;
+    fixed_t             momz;
+
     // Info for drawing: position.
     fixed_t             x;
     fixed_t             y;
     fixed_t             z;
 
+    // The closest interval over all contacted Sectors.
+    fixed_t             floorz;
+
+    int16_t             tics;   // state tic counter
+    uint16_t            flags;
+    const state_t*      state;
+
+    fixed_t             ceilingz;
+
     // More list: links in sector (if needed)
     struct mobj_s __far*      snext;
     struct mobj_s __far*__far*     sprev; // killough 8/10/98: change to ptr-to-ptr
@@ -210,10 +229,6 @@ typedef struct mobj_s
 
     struct subsector_s __far* subsector;
 
-    // The closest interval over all contacted Sectors.
-    fixed_t             floorz;
-    fixed_t             ceilingz;
-
     // killough 11/98: the lowest floor over all contacted Sectors.
     fixed_t             dropoffz;
 
@@ -221,20 +236,10 @@ typedef struct mobj_s
     fixed_t             radius;
     fixed_t             height;
 
-    // Momentums, used to update position.
-    fixed_t             momx;
-    fixed_t             momy;
-    fixed_t             momz;
-
     int16_t             health;
 
     mobjtype_t          type;
 
-    int16_t             tics;   // state tic counter
-    const state_t*      state;
-    uint16_t            flags;
-    uint16_t            pooled;
-
     // Thing being chased/attacked (or NULL),
     // also the originator for missiles.
     struct mobj_s __far*      target;
@@ -278,6 +283,8 @@ typedef struct mobj_s
 
 mobj_t __far* P_SpawnMobj(fixed_t x, fixed_t y, fixed_t z, mobjtype_t type);
 void    P_RemoveMobj(mobj_t __far* th);
+void    P_InitMobjPool(void);
+void    P_FreeMobj(mobj_t __far* mobj);
 boolean P_SetMobjState(mobj_t __far* mobj, statenum_t state);
 
 
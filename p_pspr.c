@@ -377,10 +377,12 @@ static void P_RecursiveSound(sector_t __far* sec, int16_t soundblocks, mobj_t __
   sec->soundtraversed = soundblocks+1;
   sec->soundtarget    = soundtarget;
 
-  for (i=0; i<sec->linecount; i++)
+  // Lines with the same sector on both sides aren't neighbours,
+  // flooding across them would stop right away anyway.
+  for (i=0; i<sec->neighbourcount; i++)
     {
-      sector_t __far* other;
-      const line_t __far* check = sec->lines[i];
+      sector_t __far* other = sec->neighbours[i].sector;
+      const line_t __far* check = sec->neighbours[i].line;
 
       if (!(check->flags & ML_TWOSIDED))
         continue;
@@ -390,9 +392,7 @@ static void P_RecursiveSound(sector_t __far* sec, int16_t soundblocks, mobj_t __
       if (_g_openrange <= 0)
         continue;       // closed door
 
-      other=_g_sides[check->sidenum[_g_sides[check->sidenum[0]].sector==sec]].sector;
-
-      if (!(check->flags & ML_SOUNDBLOCK))
+      if (!sec->neighbours[i].soundblock)
         P_RecursiveSound(other, soundblocks, soundtarget);
       else
         if (!soundblocks)
@@ -28,13 +28,14 @@
 
 typedef struct {
 	thinker_t thinker;				// Thinker structure for scrolling
-	int16_t __far* textureoffset;	// Affected textureoffset
+	side_t __far* side;				// Affected sidedef
 } scroll_t;
 
 
 static void T_Scroll(scroll_t __far* s)
 {
-	(*s->textureoffset)++;
+	s->side->textureoffset++;
+	R_InvalidateSector(s->side->sector);	// no line flag depends on the offset
 }
 
 
@@ -50,7 +51,7 @@ static void Add_Scroller(int16_t affectee)
 {
 	scroll_t __far* s = Z_CallocLevSpec(sizeof *s);
 	s->thinker.function = T_Scroll;
-	s->textureoffset = &_g_sides[affectee].textureoffset;
+	s->side = &_g_sides[affectee];
 	P_AddThinker(&s->thinker);
 }
 
@@ -72,6 +72,7 @@ subsector_t __far* _g_subsectors;
 
 int16_t      _g_numlines;
 line_t   __far* _g_lines;
+uint16_t __far* _g_linevalidcounts;
 
 
 static int16_t      numsides;
@@ -219,14 +220,74 @@ static void P_LoadSectors (int16_t lump)
 }
 
 
+//
+// P_InitTagLists
+// killough 1/30/98: Create xref tables for tags.
+// Chains the sectors of each tag in ascending order, hashed on the tag,
+// so P_FindSectorFromLineTag only visits sectors in the same bucket.
+//
+
+static void P_InitTagLists(void)
+{
+  int16_t i;
+
+  for (i = _g_numsectors; --i >= 0; )        // Initially make all slots empty.
+    _g_sectors[i].firsttag = -1;
+
+  for (i = _g_numsectors; --i >= 0; )        // Proceed from last to first sector
+    {                                         // so that lower sectors appear first
+      int16_t j = (uint16_t)_g_sectors[i].tag % (uint16_t)_g_numsectors; // Hashing function
+      _g_sectors[i].nexttag = _g_sectors[j].firsttag;   // Prepend sector to chain
+      _g_sectors[j].firsttag = i;
+    }
+}
+
+
 //
 // P_LoadNodes
 //
 
+#if defined REPACK_NODES
+//
+// P_RepackNode
+// Copies the subtree below nodenum depth first, child 0 before child 1,
+// to consecutive descending indices, so that walking down the tree
+// walks through memory instead of jumping around the lump.
+//
+
+static uint16_t P_RepackNode(const mapnode_t __far* src, mapnode_t __far* dest, uint16_t nodenum, int16_t *next)
+{
+  if (nodenum & NF_SUBSECTOR)
+    return nodenum;
+
+  int16_t newnum = (*next)--;
+  mapnode_t __far* node = &dest[newnum];
+
+  _fmemcpy(node, &src[nodenum], sizeof(mapnode_t));
+  node->children[0] = P_RepackNode(src, dest, src[nodenum].children[0], next);
+  node->children[1] = P_RepackNode(src, dest, src[nodenum].children[1], next);
+
+  return newnum;
+}
+#endif
+
 static void P_LoadNodes (int16_t lump)
 {
   numnodes = W_LumpLength (lump) / sizeof(mapnode_t);
   nodes = W_GetLumpByNumAutoFree (lump);
+
+#if defined REPACK_NODES
+  if (numnodes)
+  {
+    // The root stays the last node, so the BSP walkers don't have to change
+    mapnode_t __far* repacked = Z_MallocLevel(numnodes * sizeof(mapnode_t), NULL);
+    int16_t next = numnodes - 1;
+
+    P_RepackNode(nodes, repacked, numnodes - 1, &next);
+    Z_Free(nodes);
+    nodes = repacked;
+  }
+#endif
 }
 
 
@@ -240,8 +301,7 @@ static void P_LoadThings(int16_t lump)
 	_g_thingPoolSize = W_LumpLength(lump) / sizeof(mapthing_t);
 	_g_thingPool     = Z_CallocLevel(_g_thingPoolSize * sizeof(mobj_t));
 
-	for (int16_t i = 0; i < _g_thingPoolSize; i++)
-		_g_thingPool[i].type = MT_NOTHING;
+	P_InitMobjPool();
 }
 
 static void P_LoadThings2(int16_t lump)
@@ -286,6 +346,7 @@ static void P_LoadLineDefs(int16_t lump)
 {
 	_g_numlines = W_LumpLength(lump) / sizeof(packed_line_t);
 	_g_lines    = Z_MallocLevel(_g_numlines * sizeof(line_t), NULL);
+	_g_linevalidcounts = Z_CallocLevel(_g_numlines * sizeof(uint16_t));
 
 	const packed_line_t __far* lines = W_GetLumpByNum(lump);
 
@@ -314,8 +375,6 @@ static void P_LoadLineDefs(int16_t lump)
 		else
 			_g_lines[i].slopetype = ST_NEGATIVE;
 
-		_g_lines[i].validcount   = 0;
-		_g_lines[i].r_validcount = 0;
 		_g_lines[i].r_flags      = 0;
 		_g_lines[i].special      = lines[i].const_special;
 	}
@@ -380,8 +439,131 @@ static void P_LoadSideDefs (int16_t lump)
 // though current algorithm is brute-force and unoptimal.
 //
 
+#if defined FINE_BLOCKMAP
+//
+// P_LineCrossesBlock
+// True if the line touches the closed box of a mapblock,
+// given that their bounding boxes overlap.
+//
+
+static boolean P_LineCrossesBlock(const line_t __far* ld, int32_t x, int32_t y)
+{
+    int16_t front = 0, back = 0;
+
+    for (int16_t i = 0; i < 4; i++)
+    {
+        int32_t px = x + ((i & 1) ? MAPBLOCKUNITS : 0);
+        int32_t py = y + ((i & 2) ? MAPBLOCKUNITS : 0);
+        int64_t side = (int64_t)(px - ld->v1.x) * ld->dy - (int64_t)(py - ld->v1.y) * ld->dx;
+
+        if (side > 0)
+            front++;
+        else if (side < 0)
+            back++;
+    }
+
+    return front != 4 && back != 4;
+}
+
+
+//
+// P_CreateBlockMap
+// Builds a blockmap of MAPBLOCKUNITS with the same origin as the lump.
+// A mapblock only lists the lines that actually cross it, in line order,
+// in the lump's format: offsets, then lists of 0, linedefs and -1.
+//
+
+static void P_CreateBlockMap(const int16_t __far* header)
+{
+    int16_t orgx = header[0];
+    int16_t orgy = header[1];
+    int32_t width  = (uint16_t)header[2] * (int32_t)(128 / MAPBLOCKUNITS);
+    int32_t height = (uint16_t)header[3] * (int32_t)(128 / MAPBLOCKUNITS);
+    int16_t numblocks;
+    uint16_t total;
+    int16_t __far* blockmap;
+    uint16_t __far* next;
+
+    _g_bmaporgx   = ((int32_t)orgx)<<FRACBITS;
+    _g_bmaporgy   = ((int32_t)orgy)<<FRACBITS;
+
+    // _g_blocklinks has to fit in a single allocation too
+    if (height && width > (int32_t)(UINT16_MAX / sizeof(*_g_blocklinks)) / height)
+        I_Error("P_CreateBlockMap: blockmap too large");
+
+    _g_bmapwidth  = width;
+    _g_bmapheight = height;
+    numblocks = width * height;
+
+    // First count the lines per mapblock, then fill the lists.
+    next = Z_CallocLevel(numblocks * sizeof(uint16_t));
+    blockmap = NULL;
+
+    for (int16_t pass = 0; pass < 2; pass++)
+    {
+        for (int16_t i = 0; i < _g_numlines; i++)
+        {
+            const line_t __far* ld = &_g_lines[i];
+            int16_t xl = ((int32_t)ld->bbox[BOXLEFT]   - orgx) / MAPBLOCKUNITS;
+            int16_t xh = ((int32_t)ld->bbox[BOXRIGHT]  - orgx) / MAPBLOCKUNITS;
+            int16_t yl = ((int32_t)ld->bbox[BOXBOTTOM] - orgy) / MAPBLOCKUNITS;
+            int16_t yh = ((int32_t)ld->bbox[BOXTOP]    - orgy) / MAPBLOCKUNITS;
+
+            if (xh >= _g_bmapwidth)
+                xh = _g_bmapwidth - 1;
+            if (yh >= _g_bmapheight)
+                yh = _g_bmapheight - 1;
+
+            for (int16_t by = yl < 0 ? 0 : yl; by <= yh; by++)
+                for (int16_t bx = xl < 0 ? 0 : xl; bx <= xh; bx++)
+                    if (P_LineCrossesBlock(ld, orgx + (int32_t)bx * MAPBLOCKUNITS, orgy + (int32_t)by * MAPBLOCKUNITS))
+                    {
+                        if (pass == 0)
+                            next[by * _g_bmapwidth + bx]++;
+                        else
+                            blockmap[next[by * _g_bmapwidth + bx]++] = i;
+                    }
+        }
+
+        if (pass == 0)
+        {
+            int32_t size = numblocks;
+            for (int16_t b = 0; b < numblocks; b++)
+                size += next[b] + 2;
+
+            if (size > INT16_MAX)
+                I_Error("P_CreateBlockMap: blockmap too large");
+
+            total = size;
+            blockmap = Z_MallocLevel(total * sizeof(int16_t), NULL);
+
+            size = numblocks;
+            for (int16_t b = 0; b < numblocks; b++)
+            {
+                blockmap[b] = size;
+                blockmap[size] = 0;
+                size += next[b] + 2;
+                blockmap[size - 1] = -1;
+                next[b] = blockmap[b] + 1;
+            }
+        }
+    }
+
+    Z_Free(next);
+
+    _g_blockmaplump = blockmap;
+    _g_blockmap     = blockmap;
+}
+#endif
+
+
 static void P_LoadBlockMap (int16_t lump)
 {
+#if defined FINE_BLOCKMAP
+    const int16_t __far* header = W_GetLumpByNum(lump);
+    P_CreateBlockMap(header);
+    Z_Free(header);
+#else
     _g_blockmaplump = W_GetLumpByNumAutoFree(lump);
 
     _g_bmaporgx = ((int32_t)_g_blockmaplump[0])<<FRACBITS;
@@ -389,11 +571,11 @@ static void P_LoadBlockMap (int16_t lump)
     _g_bmapwidth  = _g_blockmaplump[2];
     _g_bmapheight = _g_blockmaplump[3];
 
+    _g_blockmap = _g_blockmaplump+4;
+#endif
 
     // clear out mobj chains - CPhipps - use calloc
     _g_blocklinks = Z_CallocLevel(_g_bmapwidth * _g_bmapheight * sizeof(*_g_blocklinks));
-
-    _g_blockmap = _g_blockmaplump+4;
 }
 
 //
@@ -421,6 +603,15 @@ static void P_AddLineToSector(const line_t __far* li, sector_t __far* sector)
   sector->lines[sector->linecount++] = li;
 }
 
+// sector->neighbours points into neighbourbuffer
+static void P_AddNeighbourToSector(neighbour_t __far* neighbourbuffer, const line_t __far* li, sector_t __far* sector, sector_t __far* other)
+{
+  neighbour_t __far* n = &neighbourbuffer[(sector->neighbours - neighbourbuffer) + sector->neighbourcount++];
+  n->line       = li;
+  n->sector     = other;
+  n->soundblock = (li->flags & ML_SOUNDBLOCK) != 0;
+}
+
 static void M_ClearBox (fixed_t *box)
 {
     box[BOXTOP]    = box[BOXRIGHT] = INT32_MIN;
@@ -444,6 +635,7 @@ static void P_GroupLines (void)
 {
     const line_t __far* li;
     sector_t __far* sector;
+    neighbour_t __far* neighbourbuffer;
     int16_t i,j, total = _g_numlines;
 
     // figgi
@@ -468,6 +660,8 @@ static void P_GroupLines (void)
         LN_FRONTSECTOR(li)->linecount++;
         if (LN_BACKSECTOR(li) && LN_BACKSECTOR(li) != LN_FRONTSECTOR(li))
         {
+            LN_FRONTSECTOR(li)->neighbourcount++;
+            LN_BACKSECTOR(li)->neighbourcount++;
             LN_BACKSECTOR(li)->linecount++;
             total++;
         }
@@ -484,12 +678,26 @@ static void P_GroupLines (void)
         }
     }
 
+    // allocate neighbour tables for each sector, two entries per two-sided line
+    neighbourbuffer = Z_MallocLevel((total - _g_numlines) * 2 * sizeof(neighbour_t), NULL);
+
+    for (i=0, j=0, sector = _g_sectors; i<_g_numsectors; i++, sector++)
+    {
+        sector->neighbours = &neighbourbuffer[j];
+        j += sector->neighbourcount;
+        sector->neighbourcount = 0;
+    }
+
     // Enter those lines
     for (i=0,li=_g_lines; i<_g_numlines; i++, li++)
     {
         P_AddLineToSector(li, LN_FRONTSECTOR(li));
         if (LN_BACKSECTOR(li) && LN_BACKSECTOR(li) != LN_FRONTSECTOR(li))
+        {
             P_AddLineToSector(li, LN_BACKSECTOR(li));
+            P_AddNeighbourToSector(neighbourbuffer, li, LN_FRONTSECTOR(li), LN_BACKSECTOR(li));
+            P_AddNeighbourToSector(neighbourbuffer, li, LN_BACKSECTOR(li), LN_FRONTSECTOR(li));
+        }
     }
 
     for (i=0, sector = _g_sectors; i<_g_numsectors; i++, sector++)
@@ -530,6 +738,7 @@ void P_SetupLevel(int16_t map)
     P_FreeLevelData();
 
     P_InitThinkers();
+    P_InitSecnodes();
 
     _g_leveltime = 0;
 
@@ -544,6 +753,7 @@ void P_SetupLevel(int16_t map)
     P_LoadNodes     (lumpnum + ML_NODES);
     P_LoadBlockMap  (lumpnum + ML_BLOCKMAP);
     P_LoadSectors   (lumpnum + ML_SECTORS);
+    P_InitTagLists();
     P_LoadSideDefs  (lumpnum + ML_SIDEDEFS);
     P_LoadSubsectors(lumpnum + ML_SSECTORS);
     P_LoadReject    (lumpnum + ML_REJECT);
@@ -561,6 +771,10 @@ void P_SetupLevel(int16_t map)
     // set up world state
     P_SpawnSpecials();
 
+    R_InitLineFlags();
+    R_InvalidateView();
+    P_ClearSightCache();
+
     P_MapEnd();
 }
 
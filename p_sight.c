@@ -39,6 +39,8 @@
 #include "p_maputl.h"
 #include "p_setup.h"
 
+#include "m_stats.h"
+
 #include "globdata.h"
 
 
@@ -54,6 +56,39 @@ typedef struct {
 static los_t los;
 
 
+#if defined SIGHT_CACHE
+//
+// Results of the BSP walk of P_CheckSight, keyed on the exact positions
+// of both mobjs. They only go stale when a floor or ceiling moves.
+//
+
+#define SIGHTCACHESIZE 16
+
+typedef struct {
+  fixed_t t1x, t1y, t1z, t1height;
+  fixed_t t2x, t2y, t2z, t2height;
+  uint16_t generation;
+  boolean visible;
+} sightcache_t;
+
+static sightcache_t sightcache[SIGHTCACHESIZE];
+static uint16_t sightgeneration = 1;
+
+
+void P_ClearSightCache(void)
+{
+  if (++sightgeneration == 0)
+  {
+    int16_t i;
+    for (i = 0; i < SIGHTCACHESIZE; i++)
+      sightcache[i].generation = 0;
+
+    sightgeneration = 1;
+  }
+}
+#endif
+
+
 //
 // P_DivlineSide
 // Returns side 0 (front), 1 (back), or 2 (on).
@@ -134,14 +169,15 @@ static boolean P_CrossSubsector(int16_t num)
     { // check lines
         int16_t linenum = seg->linenum;
 
-        line_t __far* line = &_g_lines[linenum];
+        line_t __far* line;
         divline_t divl;
 
         // allready checked other side?
-        if (line->validcount == validcount)
+        if (_g_linevalidcounts[linenum] == validcount)
             continue;
 
-        line->validcount = validcount;
+        _g_linevalidcounts[linenum] = validcount;
+        line = &_g_lines[linenum];
 
         if ((fixed_t)line->bbox[BOXLEFT]   << FRACBITS > los.bbox[BOXRIGHT] ||
             (fixed_t)line->bbox[BOXRIGHT]  << FRACBITS < los.bbox[BOXLEFT]  ||
@@ -265,14 +301,22 @@ boolean P_CheckSight(mobj_t __far* t1, mobj_t __far* t2)
   const sector_t __far* s1 = t1->subsector->sector;
   const sector_t __far* s2 = t2->subsector->sector;
   int16_t pnum = (s1-_g_sectors)*_g_numsectors + (s2-_g_sectors);
+#if defined SIGHT_CACHE
+  sightcache_t *sc;
+#endif
 
   // First check for trivial rejection.
   // Determine subsector entries in REJECT table.
   //
   // Check in REJECT table.
 
+  STAT_INC(sightchecks);
+
   if (_g_rejectmatrix[pnum>>3] & (1 << (pnum&7)))   // can't possibly be connected
+  {
+    STAT_INC(sightrejects);
     return false;
+  }
 
   /* killough 11/98: shortcut for melee situations
    * same subsector? obviously visible
@@ -280,6 +324,20 @@ boolean P_CheckSight(mobj_t __far* t1, mobj_t __far* t2)
   if (t1->subsector == t2->subsector)
     return true;
 
+#if defined SIGHT_CACHE
+  sc = &sightcache[((t1->x ^ t2->y) >> FRACBITS ^ (t1->y ^ t2->x) >> (FRACBITS - 2)) & (SIGHTCACHESIZE - 1)];
+
+  if (sc->generation == sightgeneration
+    && sc->t1x == t1->x && sc->t1y == t1->y && sc->t1z == t1->z && sc->t1height == t1->height
+    && sc->t2x == t2->x && sc->t2y == t2->y && sc->t2z == t2->z && sc->t2height == t2->height)
+  {
+    // keep validcount in step with the uncached build, it wraps
+    validcount++;
+    STAT_INC(sighthits);
+    return sc->visible;
+  }
+#endif
+
   // An unobstructed LOS is possible.
   // Now look from eyes of t1 to any part of t2.
 
@@ -310,5 +368,12 @@ boolean P_CheckSight(mobj_t __far* t1, mobj_t __far* t2)
   los.minz = INT32_MIN;
 
   // the head node is the last node output
+#if defined SIGHT_CACHE
+  sc->t1x = t1->x; sc->t1y = t1->y; sc->t1z = t1->z; sc->t1height = t1->height;
+  sc->t2x = t2->x; sc->t2y = t2->y; sc->t2z = t2->z; sc->t2height = t2->height;
+  sc->generation = sightgeneration;
+  return sc->visible = P_CrossBSPNode(numnodes-1);
+#else
   return P_CrossBSPNode(numnodes-1);
+#endif
 }
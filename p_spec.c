@@ -66,28 +66,6 @@
 //
 ///////////////////////////////////////////////////////////////
 
-//
-// getNextSector()
-//
-// Return sector_t * of sector next to current across line.
-//
-// Note: returns NULL if not two-sided line, or both sides refer to sector
-//
-sector_t __far* getNextSector(const line_t __far* line, sector_t __far* sec)
-{
-
-
-  if (LN_FRONTSECTOR(line) == sec)
-  {
-    if (LN_BACKSECTOR(line)!=sec)
-      return LN_BACKSECTOR(line); //jff 5/3/98 don't retn sec unless compatibility
-    else                       // fixes an intra-sector line breaking functions
-      return NULL;             // like floor->highest floor
-  }
-  return LN_FRONTSECTOR(line);
-}
-
-
 //
 // P_FindLowestFloorSurrounding()
 //
@@ -97,17 +75,12 @@ sector_t __far* getNextSector(const line_t __far* line, sector_t __far* sec)
 fixed_t P_FindLowestFloorSurrounding(sector_t __far* sec)
 {
   int16_t                 i;
-  const line_t __far*             check;
-  sector_t __far*           other;
+  const sector_t __far*     other;
   fixed_t             floor = sec->floorheight;
 
-  for (i=0 ;i < sec->linecount ; i++)
+  for (i=0 ;i < sec->neighbourcount ; i++)
   {
-    check = sec->lines[i];
-    other = getNextSector(check,sec);
-
-    if (!other)
-      continue;
+    other = sec->neighbours[i].sector;
 
     if (other->floorheight < floor)
       floor = other->floorheight;
@@ -125,17 +98,12 @@ fixed_t P_FindLowestFloorSurrounding(sector_t __far* sec)
 fixed_t P_FindHighestFloorSurrounding(sector_t __far* sec)
 {
   int16_t i;
-  const line_t __far* check;
-  sector_t __far* other;
+  const sector_t __far* other;
   fixed_t floor = -32000*FRACUNIT;
 
-  for (i=0 ;i < sec->linecount ; i++)
+  for (i=0 ;i < sec->neighbourcount ; i++)
   {
-    check = sec->lines[i];
-    other = getNextSector(check,sec);
-
-    if (!other)
-      continue;
+    other = sec->neighbours[i].sector;
 
     if (other->floorheight > floor)
       floor = other->floorheight;
@@ -153,17 +121,12 @@ fixed_t P_FindHighestFloorSurrounding(sector_t __far* sec)
 fixed_t P_FindLowestCeilingSurrounding(sector_t __far* sec)
 {
   int16_t                 i;
-  const line_t __far*             check;
-  sector_t __far*           other;
+  const sector_t __far*     other;
   fixed_t             height = 32000*FRACUNIT;
 
-  for (i=0 ;i < sec->linecount ; i++)
+  for (i=0 ;i < sec->neighbourcount ; i++)
   {
-    check = sec->lines[i];
-    other = getNextSector(check,sec);
-
-    if (!other)
-      continue;
+    other = sec->neighbours[i].sector;
 
     if (other->ceilingheight < height)
       height = other->ceilingheight;
@@ -175,17 +138,17 @@ fixed_t P_FindLowestCeilingSurrounding(sector_t __far* sec)
 //
 // RETURN NEXT SECTOR # THAT LINE TAG REFERS TO
 //
+// Walks the tag chain built by P_InitTagLists instead of all sectors.
+//
 int16_t P_FindSectorFromLineTag(const line_t __far* line, int16_t start)
 {
-    int16_t	i;
+    start = start >= 0 ? _g_sectors[start].nexttag :
+        _g_sectors[(uint16_t)line->tag % (uint16_t)_g_numsectors].firsttag;
 
-    for (i=start+1; i<_g_numsectors; i++)
-    {
-        if (_g_sectors[i].tag == line->tag)
-            return i;
-    }
+    while (start >= 0 && _g_sectors[start].tag != line->tag)
+        start = _g_sectors[start].nexttag;
 
-    return -1;
+    return start;
 }
 
 
@@ -279,6 +242,8 @@ void P_UpdateSpecials (void)
                         break;
                 }
 
+                R_SectorChanged(_g_sides[_g_buttonlist[i].line->sidenum[0]].sector);
+
                 memset(&_g_buttonlist[i],0,sizeof(button_t));
             }
         }
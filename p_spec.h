@@ -232,7 +232,6 @@ fixed_t P_FindLowestCeilingSurrounding(sector_t __far* sec);
 
 int16_t P_FindSectorFromLineTag(const line_t __far* line, int16_t start);
 
-sector_t __far* getNextSector(const line_t __far* line, sector_t __far* sec);
 
 boolean P_CheckTag(const line_t __far* line);
 
@@ -232,6 +232,8 @@ static void P_ChangeSwitchTexture(line_t __far* line, boolean useAgain)
             break;
     }
 
+    R_SectorChanged(_g_sides[line->sidenum[0]].sector);
+
     if (useAgain)
         P_StartButton(line, position, switchlist[i], BUTTONTIME);
 }
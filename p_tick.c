@@ -39,6 +39,8 @@
 #include "p_tick.h"
 #include "p_map.h"
 
+#include "m_stats.h"
+
 #include "globdata.h"
 
 
@@ -63,9 +65,38 @@ static thinker_t _g_thinkerclasscap;
 // P_InitThinkers
 //
 
+// Mobjs that can't do anything on their own are kept on a separate list,
+// so P_RunThinkers doesn't have to visit them every tic.
+static thinker_t sleepingcap;
+
+// The thinker P_RunThinkers will run next.
+static thinker_t __far* nextthinker;
+
+
 void P_InitThinkers(void)
 {
   _g_thinkerclasscap.prev = _g_thinkerclasscap.next  = &_g_thinkerclasscap;
+  sleepingcap.prev = sleepingcap.next = &sleepingcap;
+}
+
+
+static void P_LinkThinker(thinker_t __far* cap, thinker_t __far* thinker)
+{
+  cap->prev->next = thinker;
+  thinker->next = cap;
+  thinker->prev = cap->prev;
+  cap->prev = thinker;
+}
+
+
+static void P_UnlinkThinker(thinker_t __far* thinker)
+{
+  thinker_t __far* next = thinker->next;
+
+  if (thinker == nextthinker)
+    nextthinker = next;
+
+  (next->prev = thinker->prev)->next = next;
 }
 
 //
@@ -75,10 +106,34 @@ void P_InitThinkers(void)
 
 void P_AddThinker(thinker_t __far* thinker)
 {
-  _g_thinkerclasscap.prev->next = thinker;
-  thinker->next = &_g_thinkerclasscap;
-  thinker->prev = _g_thinkerclasscap.prev;
-  _g_thinkerclasscap.prev = thinker;
+  P_LinkThinker(&_g_thinkerclasscap, thinker);
+}
+
+
+//
+// P_SleepMobj
+// Moves a mobj that has no thinker function, or whose state never ends,
+// to the sleeping list.
+//
+
+void P_SleepMobj(mobj_t __far* mobj)
+{
+  mobj->flags |= MF_SLEEPING;
+  P_UnlinkThinker(&mobj->thinker);
+  P_LinkThinker(&sleepingcap, &mobj->thinker);
+}
+
+
+//
+// P_WakeMobj
+// Moves a sleeping mobj back to the end of the thinker list.
+//
+
+void P_WakeMobj(mobj_t __far* mobj)
+{
+  mobj->flags &= ~MF_SLEEPING;
+  P_UnlinkThinker(&mobj->thinker);
+  P_AddThinker(&mobj->thinker);
 }
 
 //
@@ -101,33 +156,14 @@ void P_AddThinker(thinker_t __far* thinker)
 
 static void P_RemoveThinkerDelayed(thinker_t __far* thinker)
 {
-
-    thinker_t __far* next = thinker->next;
-    /* Note that currentthinker is guaranteed to point to us,
-         * and since we're freeing our memory, we had better change that. So
-         * point it to thinker->prev, so the iterator will correctly move on to
-         * thinker->prev->next = thinker->next */
-    (next->prev = thinker->prev)->next = next;
-
+    P_UnlinkThinker(thinker);
     Z_Free(thinker);
 }
 
 static void P_RemoveThingDelayed(thinker_t __far* thinker)
 {
-
-    thinker_t __far* next = thinker->next;
-    /* Note that currentthinker is guaranteed to point to us,
-         * and since we're freeing our memory, we had better change that. So
-         * point it to thinker->prev, so the iterator will correctly move on to
-         * thinker->prev->next = thinker->next */
-    (next->prev = thinker->prev)->next = next;
-
-    mobj_t __far* thing = (mobj_t __far*)thinker;
-
-    if (thing->pooled)
-        thing->type = MT_NOTHING;
-    else
-        Z_Free(thinker);
+    P_UnlinkThinker(thinker);
+    P_FreeMobj((mobj_t __far*)thinker);
 }
 
 //
@@ -150,6 +186,9 @@ void P_RemoveThinker(thinker_t __far* thinker)
 
 void P_RemoveThing(mobj_t __far* thing)
 {
+  if (thing->flags & MF_SLEEPING)
+    P_WakeMobj(thing);
+
   thing->thinker.function = P_RemoveThingDelayed;
 }
 
@@ -184,11 +223,12 @@ static void P_RunThinkers (void)
 
     while(th != th_end)
     {
-        thinker_t __far* th_next = th->next;
+        nextthinker = th->next;
         if(th->function)
             th->function(th);
 
-        th = th_next;
+        STAT_INC(thinkers);
+        th = nextthinker;
     }
 }
 
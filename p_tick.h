@@ -47,6 +47,8 @@ void P_InitThinkers(void);
 void P_AddThinker(thinker_t __far* thinker);
 void P_RemoveThinker(thinker_t __far* thinker);
 void P_RemoveThing(mobj_t __far* thing);
+void P_SleepMobj(mobj_t __far* mobj);
+void P_WakeMobj(mobj_t __far* mobj);
 
 
 #endif
@@ -287,4 +287,5 @@ void R_Init(void)
   R_InitTextures();
   R_InitSpriteLumps();
   R_InitColormaps();
+  R_InitTextureMapping();
 }
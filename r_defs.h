@@ -78,12 +78,23 @@ typedef struct
   fixed_t y;
 } degenmobj_t;
 
+//
+// A sector across a two-sided line.
+//
+
+typedef struct
+{
+  const struct line_s __far* line;
+  struct sector_s __far* sector;
+  boolean soundblock;          // the line has ML_SOUNDBLOCK
+} neighbour_t;
+
 //
 // The SECTORS record, at runtime.
 // Stores things/mobjs.
 //
 
-typedef struct
+typedef struct sector_s
 {
   fixed_t floorheight;
   fixed_t ceilingheight;
@@ -106,12 +117,17 @@ typedef struct
 
   int16_t linecount;
 
+  // the sectors across the two-sided lines, in line order
+  const neighbour_t __far* neighbours;
+  int16_t neighbourcount;
+
   int16_t floorpic;
   int16_t ceilingpic;
 
   int16_t lightlevel;
   int16_t special;
   int16_t tag;
+  int16_t firsttag, nexttag; // killough 1/30/98: improves searches for tags.
 
   int16_t soundtraversed;    // 0 = untraversed, 1,2 = sndlines-1
 
@@ -167,8 +183,6 @@ typedef struct line_s
     uint8_t flags;           // Animation related.
     int8_t slopetype; // To aid move clipping.
 
-    uint16_t validcount;        // if == validcount, already checked
-    uint16_t r_validcount;      // cph: if == gametic, r_flags already done
     int16_t r_flags;
     int16_t special;
 } line_t;
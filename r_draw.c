@@ -51,6 +51,7 @@
 #include "i_system.h"
 #include "g_game.h"
 #include "m_random.h"
+#include "m_stats.h"
 
 #include "globdata.h"
 
@@ -88,18 +89,11 @@ static int16_t openings[MAXOPENINGS];
 static int16_t* lastopening;
 
 
-#if VIEWWINDOWWIDTH == 80
-#define VIEWANGLETOXTABLESIZE (4096-1023-1040)
-#elif VIEWWINDOWWIDTH == 60
-#define VIEWANGLETOXTABLESIZE (4096-1023-1046)
-#elif VIEWWINDOWWIDTH == 40
-#define VIEWANGLETOXTABLESIZE (4096-1023-1057)
-#elif VIEWWINDOWWIDTH == 30
-#define VIEWANGLETOXTABLESIZE (4096-1023-1068)
-#else
-#error unsupported VIEWWINDOWWIDTH value
-#endif
-static const int8_t viewangletoxTable[VIEWANGLETOXTABLESIZE];
+// viewangletox is viewwindowwidth below this fine angle and 0 from VIEWANGLETOXTABLEEND
+#define VIEWANGLETOXTABLESTART 1023
+#define VIEWANGLETOXTABLEEND   3073
+#define VIEWANGLETOXTABLESIZE (VIEWANGLETOXTABLEEND - VIEWANGLETOXTABLESTART)
+static int8_t viewangletoxTable[VIEWANGLETOXTABLESIZE];
 
 static int8_t viewangletox(int16_t va)
 {
@@ -110,37 +104,12 @@ static int8_t viewangletox(int16_t va)
 		I_Error("viewangletox: va >= 4096: %i", va);
 #endif
 
-#if VIEWWINDOWWIDTH == 80
-	if (va < 1040)			//    0 <= va < 1040
-		return VIEWWINDOWWIDTH;
-	else if (3073 <= va)	// 3073 <= va < 4096
-		return 0;
-	else					// 1040 <= va < 3073
-		return viewangletoxTable[va - 1040];
-#elif VIEWWINDOWWIDTH == 60
-	if (va < 1046)			//    0 <= va < 1046
-		return VIEWWINDOWWIDTH;
-	else if (3073 <= va)	// 3073 <= va < 4096
-		return 0;
-	else					// 1046 <= va < 3073
-		return viewangletoxTable[va - 1046];
-#elif VIEWWINDOWWIDTH == 40
-	if (va < 1057)			//    0 <= va < 1057
-		return VIEWWINDOWWIDTH;
-	else if (3073 <= va)	// 3073 <= va < 4096
+	if (va < VIEWANGLETOXTABLESTART)
+		return viewwindowwidth;
+	else if (VIEWANGLETOXTABLEEND <= va)
 		return 0;
-	else					// 1057 <= va < 3073
-		return viewangletoxTable[va - 1057];
-#elif VIEWWINDOWWIDTH == 30
-	if (va < 1068)			//    0 <= va < 1068
-		return VIEWWINDOWWIDTH;
-	else if (3073 <= va)	// 3073 <= va < 4096
-		return 0;
-	else					// 1068 <= va < 3073
-		return viewangletoxTable[va - 1068];
-#else
-#error unsupported VIEWWINDOWWIDTH value
-#endif
+	else
+		return viewangletoxTable[va - VIEWANGLETOXTABLESTART];
 }
 
 
@@ -165,127 +134,8 @@ static int16_t floorclip[VIEWWINDOWWIDTH];
 static int16_t ceilingclip[VIEWWINDOWWIDTH];
 
 
-static int16_t screenheightarray[VIEWWINDOWWIDTH] =
-{
-#if VIEWWINDOWWIDTH == 80
-	VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT,
-	VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT,
-	VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT,
-	VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT,
-	VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT,
-
-	VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT,
-	VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT,
-	VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT,
-	VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT,
-	VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT,
-
-	VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT,
-	VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT,
-	VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT,
-	VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT,
-	VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT,
-
-	VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT,
-	VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT,
-	VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT,
-	VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT,
-	VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT
-#elif VIEWWINDOWWIDTH == 60
-	VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT,
-	VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT,
-	VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT,
-	VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT,
-	VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT,
-
-	VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT,
-	VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT,
-	VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT,
-	VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT,
-	VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT
-#elif VIEWWINDOWWIDTH == 40
-	VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT,
-	VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT,
-	VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT,
-	VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT,
-	VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT,
-
-	VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT,
-	VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT,
-	VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT,
-	VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT,
-	VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT
-#elif VIEWWINDOWWIDTH == 30
-	VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT,
-	VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT,
-	VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT,
-	VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT,
-	VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT, VIEWWINDOWHEIGHT
-#else
-#error unsupported VIEWWINDOWWIDTH value
-#endif
-};
-
-static int16_t negonearray[VIEWWINDOWWIDTH] =
-{
-#if VIEWWINDOWWIDTH == 80
-	-1, -1, -1, -1,
-	-1, -1, -1, -1,
-	-1, -1, -1, -1,
-	-1, -1, -1, -1,
-	-1, -1, -1, -1,
-
-	-1, -1, -1, -1,
-	-1, -1, -1, -1,
-	-1, -1, -1, -1,
-	-1, -1, -1, -1,
-	-1, -1, -1, -1,
-
-	-1, -1, -1, -1,
-	-1, -1, -1, -1,
-	-1, -1, -1, -1,
-	-1, -1, -1, -1,
-	-1, -1, -1, -1,
-
-	-1, -1, -1, -1,
-	-1, -1, -1, -1,
-	-1, -1, -1, -1,
-	-1, -1, -1, -1,
-	-1, -1, -1, -1
-#elif VIEWWINDOWWIDTH == 60
-	-1, -1, -1, -1, -1, -1,
-	-1, -1, -1, -1, -1, -1,
-	-1, -1, -1, -1, -1, -1,
-	-1, -1, -1, -1, -1, -1,
-	-1, -1, -1, -1, -1, -1,
-
-	-1, -1, -1, -1, -1, -1,
-	-1, -1, -1, -1, -1, -1,
-	-1, -1, -1, -1, -1, -1,
-	-1, -1, -1, -1, -1, -1,
-	-1, -1, -1, -1, -1, -1
-#elif VIEWWINDOWWIDTH == 40
-	-1, -1, -1, -1,
-	-1, -1, -1, -1,
-	-1, -1, -1, -1,
-	-1, -1, -1, -1,
-	-1, -1, -1, -1,
-
-	-1, -1, -1, -1,
-	-1, -1, -1, -1,
-	-1, -1, -1, -1,
-	-1, -1, -1, -1,
-	-1, -1, -1, -1
-#elif VIEWWINDOWWIDTH == 30
-	-1, -1, -1, -1, -1, -1,
-	-1, -1, -1, -1, -1, -1,
-	-1, -1, -1, -1, -1, -1,
-	-1, -1, -1, -1, -1, -1,
-	-1, -1, -1, -1, -1, -1
-#else
-#error unsupported VIEWWINDOWWIDTH value
-#endif
-};
+static int16_t screenheightarray[VIEWWINDOWWIDTH];
+static int16_t negonearray[VIEWWINDOWWIDTH];
 
 
 //*****************************************
@@ -300,7 +150,16 @@ static fixed_t  viewx, viewy, viewz;
 static angle_t   viewangle;
 static angle16_t viewangle16;
 
+#if defined SOLIDCOL_BITSET
+// One bit per column, scanned a word at a time
+#define SOLIDCOLBITS  32
+#define SOLIDCOLWORDS ((VIEWWINDOWWIDTH + SOLIDCOLBITS - 1) / SOLIDCOLBITS)
+static uint32_t solidcol[SOLIDCOLWORDS];
+#else
 static byte solidcol[VIEWWINDOWWIDTH];
+#endif
+
+static int16_t solidcolcount; // number of solid columns, viewwindowwidth means the screen is full
 
 static const seg_t     __far* curline;
 static side_t    __far* sidedef;
@@ -382,103 +241,23 @@ uint16_t validcount = 1;         // increment every time a check is made
 
 #define COLEXTRABITS (8 - 1)
 
-static const int16_t CENTERX = VIEWWINDOWWIDTH  / 2;
        const int16_t CENTERY = VIEWWINDOWHEIGHT / 2;
 
-static const fixed_t PROJECTION = (VIEWWINDOWWIDTH / 2L) << FRACBITS;
-
-static const int16_t PSPRITESCALE  = FRACUNIT * VIEWWINDOWWIDTH / SCREENWIDTH_VGA;
-static const fixed_t PSPRITEISCALE = FRACUNIT * SCREENWIDTH_VGA / VIEWWINDOWWIDTH; // = FixedReciprocal(PSPRITESCALE)
-
 static const uint16_t PSPRITEYSCALE = FRACUNIT * (VIEWWINDOWHEIGHT * 5 / 4) / SCREENHEIGHT_VGA;
 static const uint16_t PSPRITEYFRACSTEP = (FRACUNIT * SCREENHEIGHT_VGA / (VIEWWINDOWHEIGHT * 5 / 4)) >> COLEXTRABITS; // = FixedReciprocal(PSPRITEYSCALE) >> COLEXTRABITS
 
-static const angle16_t xtoviewangleTable[VIEWWINDOWWIDTH + 1] =
-{
-#if VIEWWINDOWWIDTH == 80
-	0x2008, 0x1F80, 0x1EF8, 0x1E70,
-	0x1DE0, 0x1D50, 0x1CB8, 0x1C20,
-	0x1B80, 0x1AE0, 0x1A38, 0x1990,
-	0x18E8, 0x1838, 0x1780, 0x16C8,
-	0x1608, 0x1548, 0x1480, 0x13B8,
-	0x12E8, 0x1218, 0x1140, 0x1060,
-	0x0F80, 0x0EA0, 0x0DB8, 0x0CD0,
-	0x0BE0, 0x0AF0, 0x0A00, 0x0908,
-	0x0810, 0x0710, 0x0610, 0x0510,
-	0x0410, 0x0310, 0x0208, 0x0108,
-	0x0000, 0xFEF8, 0xFDF8, 0xFCF0,
-	0xFBF0, 0xFAF0, 0xF9F0, 0xF8F0,
-	0xF7F0, 0xF6F8, 0xF600, 0xF510,
-	0xF420, 0xF330, 0xF248, 0xF160,
-	0xF080, 0xEFA0, 0xEEC0, 0xEDE8,
-	0xED18, 0xEC48, 0xEB80, 0xEAB8,
-	0xE9F8, 0xE938, 0xE880, 0xE7C8,
-	0xE718, 0xE670, 0xE5C8, 0xE520,
-	0xE480, 0xE3E0, 0xE348, 0xE2B0,
-	0xE220, 0xE190, 0xE108, 0xE080,
-	0xDFF8
-#elif VIEWWINDOWWIDTH == 60
-	0x2008, 0x1F50, 0x1EA0, 0x1DE0,
-	0x1D20, 0x1C50, 0x1B80, 0x1AA8,
-	0x19C8, 0x18E8, 0x17F8, 0x1708,
-	0x1608, 0x1508, 0x13F8, 0x12E8,
-	0x11D0, 0x10B0, 0x0F80, 0x0E58,
-	0x0D20, 0x0BE0, 0x0AA0, 0x0958,
-	0x0810, 0x06C0, 0x0568, 0x0410,
-	0x02B8, 0x0158, 0x0000, 0xFEA8,
-	0xFD48, 0xFBF0, 0xFA98, 0xF940,
-	0xF7F0, 0xF6A8, 0xF560, 0xF420,
-	0xF2E0, 0xF1A8, 0xF080, 0xEF50,
-	0xEE30, 0xED18, 0xEC08, 0xEAF8,
-	0xE9F8, 0xE8F8, 0xE808, 0xE718,
-	0xE638, 0xE558, 0xE480, 0xE3B0,
-	0xE2E0, 0xE220, 0xE160, 0xE0B0,
-	0xDFF8
-#elif VIEWWINDOWWIDTH == 40
-	0x2008,         0x1EF8,
-	0x1DE0,         0x1CB8,
-	0x1B80,         0x1A38,
-	0x18E8,         0x1780,
-	0x1608,         0x1480,
-	0x12E8,         0x1140,
-	0x0F80,         0x0DB8,
-	0x0BE0,         0x0A00,
-	0x0810,         0x0610,
-	0x0410,         0x0208,
-	0x0000,         0xFDF8,
-	0xFBF0,         0xF9F0,
-	0xF7F0,         0xF600,
-	0xF420,         0xF248,
-	0xF080,         0xEEC0,
-	0xED18,         0xEB80,
-	0xE9F8,         0xE880,
-	0xE718,         0xE5C8,
-	0xE480,         0xE348,
-	0xE220,         0xE108,
-	0xDFF8
-#elif VIEWWINDOWWIDTH == 30
-	0x2008,         0x1EA0,
-	0x1D20,         0x1B80,
-	0x19C8,         0x17F8,
-	0x1608,         0x13F8,
-	0x11D0,         0x0F80,
-	0x0D20,         0x0AA0,
-	0x0810,         0x0568,
-	0x02B8,         0x0000,
-	0xFD48,         0xFA98,
-	0xF7F0,         0xF560,
-	0xF2E0,         0xF080,
-	0xEE30,         0xEC08,
-	0xE9F8,         0xE808,
-	0xE638,         0xE480,
-	0xE2E0,         0xE160,
-	0xDFF8
-#else
-#error unsupported VIEWWINDOWWIDTH value
-#endif
-};
+// Set by R_InitTextureMapping for the view window width
+int16_t viewwindowwidth = VIEWWINDOWWIDTH;
+
+static int16_t centerx;
+static fixed_t projection;
+
+static int16_t pspritescale;
+static fixed_t pspriteiscale; // = FixedReciprocal(pspritescale)
+
+static angle16_t xtoviewangleTable[VIEWWINDOWWIDTH + 1];
 
-static const angle16_t clipangle = 0x2008; // = xtoviewangleTable[0]
+static angle16_t clipangle; // = xtoviewangleTable[0]
 
 
 #if defined __WATCOMC__
@@ -641,10 +420,14 @@ static CONSTFUNC int16_t SlopeDiv(uint32_t num, uint32_t den)
 }
 
 
+#if defined RECIPROCAL_SLOPEDIV
+#include "r_slope.h"
+#else
 static CONSTFUNC int16_t SlopeDiv16(uint16_t n, uint16_t d)
 {
 	return ((uint32_t)n * SLOPERANGE) / d;
 }
+#endif
 
 
 //
@@ -992,7 +775,7 @@ static void R_DrawVisSprite(const vissprite_t *vis)
 
     dcvars.x = vis->x1;
 
-    while (dcvars.x < VIEWWINDOWWIDTH)
+    while (dcvars.x < viewwindowwidth)
     {
         const column_t __far* column = (const column_t __far*) ((const byte __far*)patch + (uint16_t)patch->columnofs[frac >> FRACBITS]);
         R_DrawMaskedColumn(colfunc, &dcvars, column);
@@ -1065,6 +848,39 @@ static PUREFUNC boolean R_PointOnSegSide(fixed_t x, fixed_t y, const seg_t __far
 }
 
 
+//
+// R_BinDrawSegs
+// Sorts the drawsegs with a silhouette into bins of SPRCLIPBINWIDTH columns,
+// so a sprite only has to look at the drawsegs that overlap its columns.
+// Every bin lists its drawsegs from last to first.
+//
+
+#define SPRCLIPBINSHIFT 3
+#define SPRCLIPBINWIDTH (1 << SPRCLIPBINSHIFT)
+#define SPRCLIPBINS     ((VIEWWINDOWWIDTH + SPRCLIPBINWIDTH - 1) >> SPRCLIPBINSHIFT)
+
+static uint8_t sprclipbins[SPRCLIPBINS][MAXDRAWSEGS];
+static uint8_t sprclipbincount[SPRCLIPBINS];
+
+static void R_BinDrawSegs(void)
+{
+    memset(sprclipbincount, 0, sizeof(sprclipbincount));
+
+    for (int16_t i = ds_p - _s_drawsegs; --i >= 0; )
+    {
+        const drawseg_t* ds = &_s_drawsegs[i];
+
+        if (!ds->silhouette)
+            continue;
+
+        const int16_t b2 = ds->x2 >> SPRCLIPBINSHIFT;
+
+        for (int16_t b = ds->x1 >> SPRCLIPBINSHIFT; b <= b2; b++)
+            sprclipbins[b][sprclipbincount[b]++] = i;
+    }
+}
+
+
 //
 // R_DrawSprite
 //
@@ -1086,58 +902,69 @@ static void R_DrawSprite (const vissprite_t* spr)
 
     // Scan drawsegs from end to start for obscuring segs.
     // The first drawseg that has a greater scale is the clip seg.
+    // Only the drawsegs in the bins of the sprite's columns are scanned,
+    // one bin at a time.
 
-    // Modified by Lee Killough:
-    // (pointer check was originally nonportable
-    // and buggy, by going past LEFT end of array):
+    const fixed_t gzt = spr->gz + (((int32_t)spr->patch_topoffset) << FRACBITS);
 
-    const drawseg_t* drawsegs  =_s_drawsegs;
+    const int16_t b2 = spr->x2 >> SPRCLIPBINSHIFT;
 
-    for (const drawseg_t* ds = ds_p; ds-- > drawsegs; )  // new -- killough
+    for (int16_t b = spr->x1 >> SPRCLIPBINSHIFT; b <= b2; b++)
     {
-        // determine if the drawseg obscures the sprite
-        if (ds->x1 > spr->x2 || ds->x2 < spr->x1 || !ds->silhouette)
-            continue;      // does not cover sprite
+        const int16_t binx1 = b << SPRCLIPBINSHIFT;
+        const int16_t binx2 = binx1 + SPRCLIPBINWIDTH - 1;
 
-        const int16_t r1 = ds->x1 < spr->x1 ? spr->x1 : ds->x1;
-        const int16_t r2 = ds->x2 > spr->x2 ? spr->x2 : ds->x2;
+        const int16_t sprx1 = spr->x1 > binx1 ? spr->x1 : binx1;
+        const int16_t sprx2 = spr->x2 < binx2 ? spr->x2 : binx2;
 
-        if (ds->scale1 > ds->scale2)
-        {
-            lowscale = ds->scale2;
-            scale    = ds->scale1;
-        }
-        else
-        {
-            lowscale = ds->scale1;
-            scale    = ds->scale2;
-        }
+        const uint8_t* bin = sprclipbins[b];
 
-        if (scale < spr->scale || (lowscale < spr->scale && !R_PointOnSegSide (spr->gx, spr->gy, ds->curline)))
+        for (int16_t n = sprclipbincount[b]; n--; )
         {
-            continue;               // seg is behind sprite
-        }
+            const drawseg_t* ds = &_s_drawsegs[*bin++];
 
-        // clip this piece of the sprite
-        // killough 3/27/98: optimized and made much shorter
+            // determine if the drawseg obscures the sprite
+            if (ds->x1 > sprx2 || ds->x2 < sprx1)
+                continue;      // does not cover sprite
 
-        if (ds->silhouette & SIL_BOTTOM && spr->gz < ds->bsilheight) //bottom sil
-        {
-            for (int16_t x = r1; x <= r2; x++)
+            const int16_t r1 = ds->x1 < sprx1 ? sprx1 : ds->x1;
+            const int16_t r2 = ds->x2 > sprx2 ? sprx2 : ds->x2;
+
+            if (ds->scale1 > ds->scale2)
             {
-                if (clipbot[x] == VIEWWINDOWHEIGHT)
-                    clipbot[x] = ds->sprbottomclip[x];
+                lowscale = ds->scale2;
+                scale    = ds->scale1;
+            }
+            else
+            {
+                lowscale = ds->scale1;
+                scale    = ds->scale2;
             }
-        }
 
-        fixed_t gzt = spr->gz + (((int32_t)spr->patch_topoffset) << FRACBITS);
+            if (scale < spr->scale || (lowscale < spr->scale && !R_PointOnSegSide (spr->gx, spr->gy, ds->curline)))
+            {
+                continue;               // seg is behind sprite
+            }
 
-        if (ds->silhouette & SIL_TOP && gzt > ds->tsilheight)   // top sil
-        {
-            for (int16_t x = r1; x <= r2; x++)
+            // clip this piece of the sprite
+            // killough 3/27/98: optimized and made much shorter
+
+            if (ds->silhouette & SIL_BOTTOM && spr->gz < ds->bsilheight) //bottom sil
             {
-                if (cliptop[x] == -1)
-                    cliptop[x] = ds->sprtopclip[x];
+                for (int16_t x = r1; x <= r2; x++)
+                {
+                    if (clipbot[x] == VIEWWINDOWHEIGHT)
+                        clipbot[x] = ds->sprbottomclip[x];
+                }
+            }
+
+            if (ds->silhouette & SIL_TOP && gzt > ds->tsilheight)   // top sil
+            {
+                for (int16_t x = r1; x <= r2; x++)
+                {
+                    if (cliptop[x] == -1)
+                        cliptop[x] = ds->sprtopclip[x];
+                }
             }
         }
     }
@@ -1185,15 +1012,15 @@ static void R_DrawPSprite (pspdef_t *psp, int16_t lightlevel)
     int16_t tx = psp->sx - BASEXCENTER;
 
     tx -= patch->leftoffset;
-    hl = (uint32_t) tx * PSPRITESCALE;
-    x1 = CENTERX + (hl >> FRACBITS);
+    hl = (uint32_t) tx * pspritescale;
+    x1 = centerx + (hl >> FRACBITS);
 
     tx += patch->width;
-    hl = (uint32_t) tx * PSPRITESCALE;
-    x2 = CENTERX + (hl >> FRACBITS) - 1;
+    hl = (uint32_t) tx * pspritescale;
+    x2 = centerx + (hl >> FRACBITS) - 1;
 
     // off the side
-    if (x2 < 0 || x1 > VIEWWINDOWWIDTH)
+    if (x2 < 0 || x1 > viewwindowwidth)
     {
         Z_ChangeTagToCache(patch);
         return;
@@ -1208,12 +1035,12 @@ static void R_DrawPSprite (pspdef_t *psp, int16_t lightlevel)
     vis->texturemid = (BASEYCENTER<<FRACBITS) /* +  FRACUNIT/2 */ -
             (psp->sy-topoffset);
     vis->x1 = x1 < 0 ? 0 : x1;
-    vis->x2 = x2 >= VIEWWINDOWWIDTH ? VIEWWINDOWWIDTH - 1 : x2;
+    vis->x2 = x2 >= viewwindowwidth ? viewwindowwidth - 1 : x2;
     // proff 11/06/98: Added for high-res
     vis->scale = PSPRITEYSCALE;
     vis->fracstep = PSPRITEYFRACSTEP;
 
-    vis->xiscale = PSPRITEISCALE;
+    vis->xiscale = pspriteiscale;
     vis->startfrac = 0;
 
     if (vis->x1 > x1)
@@ -1276,11 +1103,60 @@ static void isort(vissprite_t **s, int16_t n)
 	}
 }
 
+#if !defined MAXVISSPRITES
 #define MAXVISSPRITES 24
+#endif
+
 static int16_t num_vissprite;
 static vissprite_t vissprites[MAXVISSPRITES];
 static vissprite_t* vissprite_ptrs[MAXVISSPRITES];
 
+// Above this many vissprites a merge sort beats the insertion sort
+#define ISORTMAX 16
+
+#if MAXVISSPRITES > ISORTMAX
+static vissprite_t* vissprite_tmp[MAXVISSPRITES];
+
+// stable bottom-up merge sort, runs of ISORTMAX are insertion sorted first
+static void msort(vissprite_t **s, int16_t n)
+{
+	vissprite_t **src = s;
+	vissprite_t **dst = vissprite_tmp;
+
+	for (int16_t i = 0; i < n; i += ISORTMAX)
+		isort(&s[i], n - i < ISORTMAX ? n - i : ISORTMAX);
+
+	for (int16_t width = ISORTMAX; width < n; width *= 2)
+	{
+		for (int16_t lo = 0; lo < n; lo += 2 * width)
+		{
+			int16_t mid = lo + width     < n ? lo + width     : n;
+			int16_t hi  = lo + 2 * width < n ? lo + 2 * width : n;
+
+			int16_t i = lo, j = mid, k = lo;
+
+			while (i < mid && j < hi)
+				dst[k++] = src[i]->scale >= src[j]->scale ? src[i++] : src[j++];
+
+			while (i < mid)
+				dst[k++] = src[i++];
+
+			while (j < hi)
+				dst[k++] = src[j++];
+		}
+
+		vissprite_t **temp = src;
+		src = dst;
+		dst = temp;
+	}
+
+	if (src != s)
+		memcpy(s, src, n * sizeof(vissprite_t*));
+}
+#else
+#define msort isort
+#endif
+
 static void R_SortVisSprites (void)
 {
     int16_t i = num_vissprite;
@@ -1290,7 +1166,10 @@ static void R_SortVisSprites (void)
         while (--i >= 0)
             vissprite_ptrs[i] = vissprites + i;
 
-        isort(vissprite_ptrs, num_vissprite);
+        if (num_vissprite <= ISORTMAX)
+            isort(vissprite_ptrs, num_vissprite);
+        else
+            msort(vissprite_ptrs, num_vissprite);
     }
 }
 
@@ -1302,6 +1181,9 @@ static void R_DrawMasked(void)
 {
     R_SortVisSprites();
 
+    if (num_vissprite)
+        R_BinDrawSegs();
+
     // draw all vissprites back to front
     for (int16_t i = num_vissprite; --i >= 0; )
         R_DrawSprite(vissprite_ptrs[i]);
@@ -1313,14 +1195,24 @@ static void R_DrawMasked(void)
 //
 // R_NewVisSprite
 //
-static vissprite_t *R_NewVisSprite(void)
+// When all vissprites are in use, the one furthest away is replaced
+// by a nearer sprite, so it's the far sprites that get dropped.
+//
+static vissprite_t *R_NewVisSprite(fixed_t scale)
 {
     if (num_vissprite >= MAXVISSPRITES)
     {
-#ifdef RANGECHECK
-        I_Error("Vissprite overflow.");
-#endif
-        return NULL;
+        vissprite_t *furthest = vissprites;
+
+        for (int16_t i = 1; i < MAXVISSPRITES; i++)
+        {
+            if (vissprites[i].scale < furthest->scale)
+                furthest = &vissprites[i];
+        }
+
+        STAT_INC(droppedsprites);
+
+        return scale > furthest->scale ? furthest : NULL;
     }
 
     return vissprites + num_vissprite++;
@@ -1426,20 +1318,20 @@ static void R_ProjectSprite (mobj_t __far* thing, int16_t lightlevel)
     else
         tx -= ((int32_t)patch->leftoffset) << FRACBITS;
 
-    //const fixed_t xscale = FixedDiv(PROJECTION, tz);
-    const fixed_t xscale = PROJECTION / (tz >> FRACBITS);
+    //const fixed_t xscale = FixedDiv(projection, tz);
+    const fixed_t xscale = projection / (tz >> FRACBITS);
 
-    fixed_t xl = CENTERX * FRACUNIT + FixedMul(tx,xscale);
+    fixed_t xl = centerx * FRACUNIT + FixedMul(tx,xscale);
     const int16_t x1 = (xl >> FRACBITS);
 
     // off the side?
-    if (x1 > VIEWWINDOWWIDTH)
+    if (x1 > viewwindowwidth)
     {
         Z_ChangeTagToCache(patch);
         return;
     }
 
-    fixed_t xr = CENTERX * FRACUNIT - FRACUNIT + FixedMul(tx + (((int32_t)patch->width) << FRACBITS), xscale);
+    fixed_t xr = centerx * FRACUNIT - FRACUNIT + FixedMul(tx + (((int32_t)patch->width) << FRACBITS), xscale);
     const int16_t x2 = (xr >> FRACBITS);
 
     // off the side?
@@ -1457,18 +1349,20 @@ static void R_ProjectSprite (mobj_t __far* thing, int16_t lightlevel)
     }
 
 
+    //const fixed_t scale = FixedDiv(PROJECTIONY, tz);
+    const fixed_t scale = (VIEWWINDOWHEIGHT * FRACUNIT) / (tz >> FRACBITS);
+
     // store information in a vissprite
-    vissprite_t* vis = R_NewVisSprite ();
+    vissprite_t* vis = R_NewVisSprite (scale);
 
-    //No more vissprites.
+    //No more vissprites, or all of them are nearer.
     if(!vis)
     {
         Z_ChangeTagToCache(patch);
         return;
     }
 
-    //vis->scale           = FixedDiv(PROJECTIONY, tz);
-    vis->scale           = (VIEWWINDOWHEIGHT * FRACUNIT) / (tz >> FRACBITS);
+    vis->scale           = scale;
     vis->fracstep        = tz / (VIEWWINDOWHEIGHT << COLEXTRABITS);
     vis->lump_num        = sprframe->lump[rot];
     vis->patch_topoffset = patch->topoffset;
@@ -1477,7 +1371,7 @@ static void R_ProjectSprite (mobj_t __far* thing, int16_t lightlevel)
     vis->gz              = fz;
     vis->texturemid      = (fz + (((int32_t)patch->topoffset) << FRACBITS)) - viewz;
     vis->x1              = x1 < 0 ? 0 : x1;
-    vis->x2              = x2 >= VIEWWINDOWWIDTH ? VIEWWINDOWWIDTH - 1 : x2;
+    vis->x2              = x2 >= viewwindowwidth ? viewwindowwidth - 1 : x2;
 
 
     const fixed_t iscale = FixedReciprocal(xscale);
@@ -1509,6 +1403,195 @@ static void R_ProjectSprite (mobj_t __far* thing, int16_t lightlevel)
         vis->colormap = R_LoadColorMap(lightlevel); // diminished light
 }
 
+#if defined RENDER_SKIP
+//
+// Render skipping
+// A frame is only rendered when the view has changed,
+// or a sector or a thing that was visible in the last rendered frame.
+// Otherwise the previous view window is presented again.
+//
+
+#define SKIPSECTORS   1024 // sectors beyond this aren't tracked, so they are always rendered
+#define MAXSKIPTHINGS   48 // with more things in the visible sectors, the frame is always rendered
+
+typedef struct
+{
+    fixed_t x, y, z;
+    angle_t angle;
+    int16_t extralight;
+    int16_t fixedcolormap;
+    int16_t lightlevel;     // of the player's sector, for the player sprites
+    boolean shadow;         // invisible player sprites
+    const state_t* pspstate[NUMPSPRITES];
+    int16_t pspsx[NUMPSPRITES];
+    fixed_t pspsy[NUMPSPRITES];
+} skipview_t;
+
+typedef struct
+{
+    const mobj_t __far* mobj;
+    fixed_t x, y, z;
+    uint16_t angle;
+    spritenum_t sprite;
+    uint16_t frame;
+    uint16_t flags;
+} skipthing_t;
+
+boolean viewwindowchanged = true;
+
+static boolean viewdirty = true;
+static boolean untrackedsector;
+static uint8_t visiblesectors[SKIPSECTORS / 8];
+
+static skipview_t lastview;
+static skipthing_t skipthings[MAXSKIPTHINGS];
+static int16_t numskipthings;
+
+
+static void R_MarkSectorVisible(const sector_t __far* sector)
+{
+    uint16_t i = sector - _g_sectors;
+
+    if (i < SKIPSECTORS)
+        visiblesectors[i >> 3] |= 1 << (i & 7);
+    else
+        untrackedsector = true;
+}
+
+
+//
+// R_InvalidateSector
+// A sector that was visible in the last rendered frame has changed.
+//
+void R_InvalidateSector(const sector_t __far* sector)
+{
+    uint16_t i = sector - _g_sectors;
+
+    if (i >= SKIPSECTORS || (visiblesectors[i >> 3] & (1 << (i & 7))))
+        viewdirty = true;
+}
+
+
+//
+// R_InvalidateView
+// The next frame is always rendered, e.g. after loading a level.
+//
+void R_InvalidateView(void)
+{
+    viewdirty = true;
+}
+
+
+static void R_GetSkipView(const player_t* player, skipview_t* view)
+{
+    memset(view, 0, sizeof(*view));
+
+    view->x             = player->mo->x;
+    view->y             = player->mo->y;
+    view->z             = player->viewz;
+    view->angle         = player->mo->angle;
+    view->extralight    = player->extralight;
+    view->fixedcolormap = player->fixedcolormap;
+    view->lightlevel    = player->mo->subsector->sector->lightlevel;
+    view->shadow        = player->powers[pw_invisibility] > 4*32 || player->powers[pw_invisibility] & 8;
+
+    for (int16_t i = 0; i < NUMPSPRITES; i++)
+    {
+        view->pspstate[i] = player->psprites[i].state;
+        view->pspsx[i]    = player->psprites[i].sx;
+        view->pspsy[i]    = player->psprites[i].sy;
+    }
+}
+
+
+//
+// R_CheckThings
+// Compares the things in the visible sectors with the last rendered frame,
+// or records them when record is true.
+// Returns true when they differ.
+//
+static boolean R_CheckThings(boolean record)
+{
+    int16_t n = 0;
+    int16_t numsectors = _g_numsectors < SKIPSECTORS ? _g_numsectors : SKIPSECTORS;
+
+    for (int16_t i = 0; i < numsectors; i++)
+    {
+        if (!(visiblesectors[i >> 3] & (1 << (i & 7))))
+            continue;
+
+        for (const mobj_t __far* thing = _g_sectors[i].thinglist; thing; thing = thing->snext)
+        {
+            if (n == MAXSKIPTHINGS)
+            {
+                numskipthings = MAXSKIPTHINGS + 1;
+                return true;
+            }
+
+            skipthing_t* st = &skipthings[n++];
+
+            if (record)
+            {
+                st->mobj   = thing;
+                st->x      = thing->x;
+                st->y      = thing->y;
+                st->z      = thing->z;
+                st->angle  = thing->angle >> FRACBITS;
+                st->sprite = thing->sprite;
+                st->frame  = thing->frame;
+                st->flags  = thing->flags;
+            }
+            else if (st->mobj   != thing
+                  || st->x      != thing->x
+                  || st->y      != thing->y
+                  || st->z      != thing->z
+                  || st->angle  != (uint16_t)(thing->angle >> FRACBITS)
+                  || st->sprite != thing->sprite
+                  || st->frame  != thing->frame
+                  || st->flags  != thing->flags)
+                return true;
+        }
+    }
+
+    if (record)
+    {
+        numskipthings = n;
+        return false;
+    }
+    else
+        return n != numskipthings;
+}
+
+
+//
+// R_NeedsRendering
+// Returns false when the view window still shows what the player sees.
+//
+static boolean R_NeedsRendering(const player_t* player)
+{
+    skipview_t view;
+    R_GetSkipView(player, &view);
+
+    boolean changed = viewdirty || untrackedsector
+        || memcmp(&view, &lastview, sizeof(skipview_t))
+        || R_CheckThings(false);
+
+    if (changed)
+    {
+        lastview = view;
+        viewdirty = false;
+        untrackedsector = false;
+        memset(visiblesectors, 0, sizeof(visiblesectors));
+    }
+
+    return changed;
+}
+
+#else
+#define R_MarkSectorVisible(sector)	((void)0)
+#endif
+
+
 //
 // R_AddSprites
 // During BSP traversal, this adds sprites by sector.
@@ -1655,7 +1738,35 @@ static const byte __far* R_ComposeColumn(const int16_t texture, const texture_t
     return colcache;
 }
 
+#if defined WIDE_COLUMNS
+// number of adjacent screen columns drawn by the next wall column
+static int16_t columnwidth = 1;
+
+static void R_DrawWallColumn(const draw_column_vars_t* dcvars)
+{
+    if (columnwidth == 1)
+        R_DrawColumn(dcvars);
+    else
+        R_DrawColumnWide(dcvars, columnwidth);
+}
+
+static void R_DrawWallColumnFlat(uint8_t col, const draw_column_vars_t* dcvars)
+{
+    draw_column_vars_t dc = *dcvars;
+
+    for (int16_t i = 0; i < columnwidth; i++, dc.x++)
+        R_DrawColumnFlat(col, &dc);
+}
+#else
+#define R_DrawWallColumn     R_DrawColumn
+#define R_DrawWallColumnFlat R_DrawColumnFlat
+#endif
+
+#if defined DEFERRED_COLUMNS
+static void R_DrawSegTextureColumnNow(const texture_t __far* tex, int16_t texture, int16_t texcolumn, draw_column_vars_t* dcvars)
+#else
 static void R_DrawSegTextureColumn(const texture_t __far* tex, int16_t texture, int16_t texcolumn, draw_column_vars_t* dcvars)
+#endif
 {
     if (!tex->overlapped)
     {
@@ -1665,13 +1776,13 @@ static void R_DrawSegTextureColumn(const texture_t __far* tex, int16_t texture,
 
         const patch_t __far* patch = W_TryGetLumpByNum(patch_num);
         if (patch == NULL)
-            R_DrawColumnFlat(texture, dcvars);
+            R_DrawWallColumnFlat(texture, dcvars);
         else
         {
             const column_t __far* column = (const column_t __far*) ((const byte __far*)patch + (uint16_t)patch->columnofs[x_c]);
 
             dcvars->source = (const byte __far*)column + 3;
-            R_DrawColumn (dcvars);
+            R_DrawWallColumn(dcvars);
             Z_ChangeTagToCache(patch);
         }
     }
@@ -1679,14 +1790,332 @@ static void R_DrawSegTextureColumn(const texture_t __far* tex, int16_t texture,
     {
         const byte __far* source = R_ComposeColumn(texture, tex, texcolumn);
         if (source == NULL)
-            R_DrawColumnFlat(texture, dcvars);
+            R_DrawWallColumnFlat(texture, dcvars);
         else
         {
             dcvars->source = source;
-            R_DrawColumn (dcvars);
+            R_DrawWallColumn(dcvars);
         }
     }
 }
+
+
+#if defined DEFERRED_COLUMNS
+//
+// Wall columns don't overlap each other,
+// so they can be drawn in any order.
+// They are queued and drawn grouped by colormap,
+// before the sprites are drawn.
+// Within a colormap the columns keep the order of the BSP traversal,
+// so the columns of a seg stay together.
+//
+
+#define MAXWALLCOLUMNS      (VIEWWINDOWWIDTH * 2)
+#define NUMWALLCOLORMAPS    (NUMCOLORMAPS + 2)   // including the inverse colormap
+
+typedef struct
+{
+    const texture_t __far* tex;
+    int16_t  texture;
+    int16_t  texcolumn;
+    int16_t  x;
+    int16_t  yl;
+    int16_t  yh;
+    uint16_t fracstep;
+    fixed_t  texturemid;
+    uint8_t  colormap;  // index into fullcolormap
+#if defined WIDE_COLUMNS
+    uint8_t  width;
+#endif
+} wallcolumn_t;
+
+static wallcolumn_t wallcolumns[MAXWALLCOLUMNS];
+static int16_t numwallcolumns;
+static int16_t wallcolumnorder[MAXWALLCOLUMNS];
+
+static void R_FlushWallColumns(void)
+{
+    int16_t start[NUMWALLCOLORMAPS + 1];
+    int16_t* order = wallcolumnorder;
+
+    // counting sort on colormap
+    memset(start, 0, sizeof(start));
+
+    for (int16_t i = 0; i < numwallcolumns; i++)
+        start[wallcolumns[i].colormap + 1]++;
+
+    for (int16_t cm = 0; cm < NUMWALLCOLORMAPS; cm++)
+        start[cm + 1] += start[cm];
+
+    for (int16_t i = 0; i < numwallcolumns; i++)
+        order[start[wallcolumns[i].colormap]++] = i;
+
+    draw_column_vars_t dcvars;
+
+    for (int16_t i = 0; i < numwallcolumns; i++)
+    {
+        const wallcolumn_t* wc = &wallcolumns[order[i]];
+
+        dcvars.x          = wc->x;
+        dcvars.yl         = wc->yl;
+        dcvars.yh         = wc->yh;
+        dcvars.fracstep   = wc->fracstep;
+        dcvars.texturemid = wc->texturemid;
+        dcvars.colormap   = fullcolormap + wc->colormap * 256;
+
+#if defined WIDE_COLUMNS
+        columnwidth = wc->width;
+#endif
+        R_DrawSegTextureColumnNow(wc->tex, wc->texture, wc->texcolumn, &dcvars);
+    }
+
+#if defined WIDE_COLUMNS
+    columnwidth = 1;
+#endif
+
+    numwallcolumns = 0;
+}
+
+
+static void R_DrawSegTextureColumn(const texture_t __far* tex, int16_t texture, int16_t texcolumn, draw_column_vars_t* dcvars)
+{
+    if (numwallcolumns == MAXWALLCOLUMNS)
+        R_FlushWallColumns();
+
+    wallcolumn_t* wc = &wallcolumns[numwallcolumns++];
+
+    wc->tex        = tex;
+    wc->texture    = texture;
+    wc->texcolumn  = texcolumn;
+    wc->x          = dcvars->x;
+    wc->yl         = dcvars->yl;
+    wc->yh         = dcvars->yh;
+    wc->fracstep   = dcvars->fracstep;
+    wc->texturemid = dcvars->texturemid;
+    wc->colormap   = (dcvars->colormap - fullcolormap) >> 8;
+#if defined WIDE_COLUMNS
+    wc->width      = columnwidth;
+#endif
+
+#if defined RANGECHECK
+    if (wc->colormap >= NUMWALLCOLORMAPS)
+        I_Error("R_DrawSegTextureColumn: colormap %i out of range", wc->colormap);
+#endif
+}
+#endif
+#endif
+
+#if defined WIDE_COLUMNS && !defined FLAT_WALL
+//
+// Adjacent wall columns with the same texture column,
+// the same vertical range, the same scale and the same colormap
+// are identical, so they are drawn together as one wide column.
+// Every wall tier has its own run.
+//
+
+#define MAXCOLUMNRUN    4
+
+enum
+{
+    TIER_TOP,
+    TIER_MID,
+    TIER_BOTTOM,
+    NUMTIERS
+};
+
+typedef struct
+{
+    const texture_t __far* tex;
+    int16_t  texture;
+    int16_t  texcolumn;
+    int16_t  width;
+    draw_column_vars_t dcvars;
+} columnrun_t;
+
+static columnrun_t columnruns[NUMTIERS];
+
+static void R_FlushColumnRun(columnrun_t* run)
+{
+    if (run->width)
+    {
+        columnwidth = run->width;
+        R_DrawSegTextureColumn(run->tex, run->texture, run->texcolumn, &run->dcvars);
+        columnwidth = 1;
+        run->width = 0;
+    }
+}
+
+
+static void R_FlushColumnRuns(void)
+{
+    for (int16_t tier = 0; tier < NUMTIERS; tier++)
+        R_FlushColumnRun(&columnruns[tier]);
+}
+
+
+static void R_AddColumnToRun(int16_t tier, const texture_t __far* tex, int16_t texture, int16_t texcolumn, const draw_column_vars_t* dcvars)
+{
+    columnrun_t* run = &columnruns[tier];
+
+    if (run->width
+        && run->width < MAXCOLUMNRUN
+        && dcvars->x          == run->dcvars.x + run->width
+        && texcolumn          == run->texcolumn
+        && texture            == run->texture
+        && dcvars->yl         == run->dcvars.yl
+        && dcvars->yh         == run->dcvars.yh
+        && dcvars->fracstep   == run->dcvars.fracstep
+        && dcvars->texturemid == run->dcvars.texturemid
+        && dcvars->colormap   == run->dcvars.colormap)
+    {
+        run->width++;
+        return;
+    }
+
+    R_FlushColumnRun(run);
+
+    run->tex       = tex;
+    run->texture   = texture;
+    run->texcolumn = texcolumn;
+    run->width     = 1;
+    run->dcvars    = *dcvars;
+}
+#else
+#define R_AddColumnToRun(t,w,x,y,z) R_DrawSegTextureColumn(w,x,y,z)
+#define R_FlushColumnRuns()
+#endif
+
+//
+// Solid column bookkeeping
+//
+
+#if defined SOLIDCOL_BITSET
+static int16_t R_CountTrailingZeros(uint32_t bits)
+{
+#if defined __GNUC__
+    return __builtin_ctzl(bits);
+#else
+    int16_t n = 0;
+    while (!(bits & 1))
+    {
+        bits >>= 1;
+        n++;
+    }
+    return n;
+#endif
+}
+
+//
+// R_FindSolidCol
+// Returns the first column in [first, last) that is solid if solid is true,
+// or not solid if solid is false. Returns last if there is no such column.
+//
+
+static int16_t R_FindSolidCol(int16_t first, int16_t last, boolean solid)
+{
+    int16_t w = first / SOLIDCOLBITS;
+    uint32_t bits = solid ? solidcol[w] : ~solidcol[w];
+    bits &= UINT32_MAX << (first % SOLIDCOLBITS);
+
+    while (!bits)
+    {
+        if (++w * SOLIDCOLBITS >= last)
+            return last;
+
+        bits = solid ? solidcol[w] : ~solidcol[w];
+    }
+
+    first = w * SOLIDCOLBITS + R_CountTrailingZeros(bits);
+    return first < last ? first : last;
+}
+
+static void R_SetSolidCol(int16_t x)
+{
+    solidcol[x / SOLIDCOLBITS] |= 1UL << (x % SOLIDCOLBITS);
+}
+
+static void R_SetSolidCols(int16_t first, int16_t last)
+{
+    while (first < last)
+    {
+        int16_t w = first / SOLIDCOLBITS;
+        int16_t n = MIN(last - w * SOLIDCOLBITS, SOLIDCOLBITS);
+        uint32_t bits = UINT32_MAX << (first % SOLIDCOLBITS);
+
+        if (n < SOLIDCOLBITS)
+            bits &= UINT32_MAX >> (SOLIDCOLBITS - n);
+
+        solidcol[w] |= bits;
+        first = (w + 1) * SOLIDCOLBITS;
+    }
+}
+#else
+static int16_t R_FindSolidCol(int16_t first, int16_t last, boolean solid)
+{
+    const byte *p = memchr(solidcol + first, solid, last - first);
+    return p ? p - solidcol : last;
+}
+
+#define R_SetSolidCol(x)              solidcol[x] = 1
+#define R_SetSolidCols(first, last)   memset(solidcol + (first), 1, (last) - (first))
+#endif
+
+#if defined WALL_STEPPING && !defined FLAT_WALL
+//
+// Wall stepping
+// The texture column and the texture step are only calculated exactly
+// every WALLSTEPCOLUMNS columns. In between they are interpolated linearly,
+// which saves a tangent lookup, a multiplication and a division per column.
+//
+// Only the scale is linear in screen x, the texture column and the
+// inverse scale are not. Over a span whose scale goes from smin to smax
+// linear stepping is off by at most (smax/smin - 1) / 4 of their change.
+// Spans are only stepped if that keeps the texture column within half a
+// texel and the texture step within 1/128, otherwise every column of the
+// span is calculated exactly.
+//
+
+#define WALLSTEPSHIFT   2
+#define WALLSTEPCOLUMNS (1 << WALLSTEPSHIFT)
+
+// texture column of screen column x, with a fraction
+static fixed_t R_TextureColumnFrac(int16_t x)
+{
+    fixed_t u = (fixed_t)rw_offset << FRACBITS;
+
+    int16_t ang = (angle16_t)(rw_centerangle + xtoviewangleTable[x]) >> ANGLETOFINESHIFT_16;
+    if (ang < 1024) {			//    0 <= ang < 1024
+        fixed_t tan = finetangentTable_part_4[1023 - ang];
+        u += rw_distance * tan;
+    } else if (ang < 2048) {	// 1024 <= ang < 2048
+        fixed_t tan = finetangentTable_part_3[1023 - (ang - 1024)];
+        u += rw_distance * tan;
+    } else if (ang < 3072) {	// 2048 <= ang < 3072
+        fixed_t tan = finetangentTable_part_3[ang - 2048];
+        u -= rw_distance * tan;
+        u += FRACUNIT - 1;		// round like the non-stepped subtraction
+    } else {					// 3072 <= ang < 4096
+        fixed_t tan = finetangentTable_part_4[ang - 3072];
+        u -= rw_distance * tan;
+        u += FRACUNIT - 1;
+    }
+
+    return u;
+}
+
+
+static boolean R_WallSpanIsLinear(fixed_t scale, fixed_t nextscale, fixed_t du)
+{
+    fixed_t smin = scale < nextscale ? scale : nextscale;
+    fixed_t ds   = D_abs(nextscale - scale);
+    fixed_t texels = D_abs(du) >> FRACBITS;
+
+    if (ds > smin >> 5)
+        return false;       // texture step off by more than 1/128
+
+    // texels * ds / (4 * smin) <= 1/2
+    return ds == 0 || texels <= 64 || texels <= (2 * smin) / ds;
+}
 #endif
 
 //
@@ -1705,6 +2134,20 @@ static void R_RenderSegLoop(int16_t rw_x, boolean segtextured, boolean markfloor
 
     dcvars.colormap = R_LoadColorMap(rw_lightlevel);
 
+#if defined WALL_STEPPING && !defined FLAT_WALL
+    // exact values at the next knot, and the steps towards it
+    int16_t knot = rw_x;
+    boolean linear = false;
+    fixed_t texu = 0, texustep = 0, nexttexu = 0;
+    int32_t iscale = 0, iscalestep = 0, nextiscale = 0;
+
+    if (segtextured)
+    {
+        nexttexu   = R_TextureColumnFrac(rw_x);
+        nextiscale = FixedReciprocal((uint32_t)rw_scale);
+    }
+#endif
+
     for ( ; rw_x < rw_stopx ; rw_x++)
     {
         // mark floor / ceiling areas
@@ -1763,6 +2206,49 @@ static void R_RenderSegLoop(int16_t rw_x, boolean segtextured, boolean markfloor
         if (segtextured)
         {
             // calculate texture offset
+#if defined WALL_STEPPING && !defined FLAT_WALL
+            if (rw_x == knot)
+            {
+                texu   = nexttexu;
+                iscale = nextiscale;
+
+                int16_t n = rw_stopx - 1 - rw_x;
+                if (n > WALLSTEPCOLUMNS)
+                    n = WALLSTEPCOLUMNS;
+
+                if (n)
+                {
+                    fixed_t nextscale = rw_scale + n * rw_scalestep;
+
+                    knot = rw_x + n;
+                    nexttexu   = R_TextureColumnFrac(knot);
+                    nextiscale = FixedReciprocal((uint32_t)nextscale);
+                    linear     = R_WallSpanIsLinear(rw_scale, nextscale, nexttexu - texu);
+
+                    if (n == WALLSTEPCOLUMNS)
+                    {
+                        texustep   = (nexttexu   - texu)   >> WALLSTEPSHIFT;
+                        iscalestep = (nextiscale - iscale) >> WALLSTEPSHIFT;
+                    }
+                    else
+                    {
+                        texustep   = (nexttexu   - texu)   / n;
+                        iscalestep = (nextiscale - iscale) / n;
+                    }
+                }
+            }
+            else if (!linear)
+            {
+                texu   = R_TextureColumnFrac(rw_x);
+                iscale = FixedReciprocal((uint32_t)rw_scale);
+            }
+
+            texturecolumn = texu >> FRACBITS;
+            dcvars.fracstep = (uint32_t)iscale >> COLEXTRABITS;
+
+            texu   += texustep;
+            iscale += iscalestep;
+#else
 #if !defined FLAT_WALL
 			texturecolumn = rw_offset;
 			int16_t ang = (angle16_t)(rw_centerangle + xtoviewangleTable[rw_x]) >> ANGLETOFINESHIFT_16;
@@ -1782,6 +2268,7 @@ static void R_RenderSegLoop(int16_t rw_x, boolean segtextured, boolean markfloor
 #endif
 
             dcvars.fracstep = FixedReciprocal((uint32_t)rw_scale) >> COLEXTRABITS;
+#endif
         }
 
         // draw the wall tiers
@@ -1792,7 +2279,7 @@ static void R_RenderSegLoop(int16_t rw_x, boolean segtextured, boolean markfloor
             dcvars.texturemid = rw_midtexturemid;
             //
 
-            R_DrawSegTextureColumn(texmidtexture, midtexture, texturecolumn, &dcvars);
+            R_AddColumnToRun(TIER_MID, texmidtexture, midtexture, texturecolumn, &dcvars);
 
             cc_rwx = VIEWWINDOWHEIGHT;
             fc_rwx = -1;
@@ -1815,7 +2302,7 @@ static void R_RenderSegLoop(int16_t rw_x, boolean segtextured, boolean markfloor
                     dcvars.yh = mid;
                     dcvars.texturemid = rw_toptexturemid;
 
-                    R_DrawSegTextureColumn(textoptexture, toptexture, texturecolumn, &dcvars);
+                    R_AddColumnToRun(TIER_TOP, textoptexture, toptexture, texturecolumn, &dcvars);
 
                     cc_rwx = mid;
                 }
@@ -1844,7 +2331,7 @@ static void R_RenderSegLoop(int16_t rw_x, boolean segtextured, boolean markfloor
                     dcvars.yh = yh;
                     dcvars.texturemid = rw_bottomtexturemid;
 
-                    R_DrawSegTextureColumn(texbottomtexture, bottomtexture, texturecolumn, &dcvars);
+                    R_AddColumnToRun(TIER_BOTTOM, texbottomtexture, bottomtexture, texturecolumn, &dcvars);
 
                     fc_rwx = mid;
                 }
@@ -1861,7 +2348,8 @@ static void R_RenderSegLoop(int16_t rw_x, boolean segtextured, boolean markfloor
             // add this info to the solid columns array for r_bsp.c
             if ((markceiling || markfloor) && (fc_rwx <= cc_rwx + 1))
             {
-                solidcol[rw_x] = 1;
+                R_SetSolidCol(rw_x);
+                solidcolcount++;
                 didsolidcol = true;
             }
         }
@@ -1873,6 +2361,8 @@ static void R_RenderSegLoop(int16_t rw_x, boolean segtextured, boolean markfloor
         floorclip[rw_x] = fc_rwx;
         ceilingclip[rw_x] = cc_rwx;
     }
+
+    R_FlushColumnRuns();
 }
 
 static boolean R_CheckOpenings(const int16_t start)
@@ -1892,7 +2382,7 @@ static boolean R_CheckOpenings(const int16_t start)
 static void R_ClearOpeningClippingDetermination(void)
 {
 	// opening / clipping determination
-	for (int8_t i = 0; i < VIEWWINDOWWIDTH; i++)
+	for (int8_t i = 0; i < viewwindowwidth; i++)
 		floorclip[i] = VIEWWINDOWHEIGHT, ceilingclip[i] = -1;
 }
 
@@ -1923,6 +2413,16 @@ inline static int16_t CONSTFUNC Mod(int16_t a, int16_t b)
 }
 
 
+// The flags of the back side of a line are stored RF_BACKSHIFT bits higher
+#define RF_BACKSHIFT 3
+
+// the closed and ignore flags of the side of curline
+static int16_t R_LineFlags(void)
+{
+    return curline->sidenum == linedef->sidenum[0] ? linedef->r_flags : linedef->r_flags >> RF_BACKSHIFT;
+}
+
+
 //
 // R_StoreWallRange
 // A wall segment will be drawn
@@ -2023,7 +2523,7 @@ static void R_StoreWallRange(const int16_t start, const int16_t stop)
         ds_p->sprtopclip = ds_p->sprbottomclip = NULL;
         ds_p->silhouette = SIL_NONE;
 
-        if(linedef->r_flags & RF_CLOSED)
+        if(R_LineFlags() & RF_CLOSED)
         { /* cph - closed 2S line e.g. door */
             // cph - killough's (outdated) comment follows - this deals with both
             // "automap fixes", his and mine
@@ -2205,34 +2705,38 @@ static void R_StoreWallRange(const int16_t start, const int16_t stop)
 //
 // cph - converted to R_RecalcLineFlags. This recalculates all the flags for
 // a line, including closure and texture tiling.
+//
+// The closed and ignore flags are only recalculated when a sector changes.
 
-static void R_RecalcLineFlags(void)
+static int16_t R_CalcLineFlags(const line_t __far* line, int16_t s)
 {
-    const side_t __far* side = &_g_sides[curline->sidenum];
+    if (!(line->flags & ML_TWOSIDED) || line->sidenum[s ^ 1] == NO_INDEX)
+        return RF_CLOSED;
 
-    linedef->r_validcount = _g_gametic;
+    const side_t   __far* side  = &_g_sides[line->sidenum[s]];
+    const sector_t __far* front = side->sector;
+    const sector_t __far* back  = _g_sides[line->sidenum[s ^ 1]].sector;
 
     /* First decide if the line is closed, normal, or invisible */
-    if (!(linedef->flags & ML_TWOSIDED)
-            || backsector->ceilingheight <= frontsector->floorheight
-            || backsector->floorheight >= frontsector->ceilingheight
+    if (back->ceilingheight <= front->floorheight
+            || back->floorheight >= front->ceilingheight
             || (
                 // if door is closed because back is shut:
-                backsector->ceilingheight <= backsector->floorheight
+                back->ceilingheight <= back->floorheight
 
                 // preserve a kind of transparent door/lift special effect:
-                && (backsector->ceilingheight >= frontsector->ceilingheight ||
+                && (back->ceilingheight >= front->ceilingheight ||
                     side->toptexture)
 
-                && (backsector->floorheight <= frontsector->floorheight ||
+                && (back->floorheight <= front->floorheight ||
                     side->bottomtexture)
 
                 // properly render skies (consider door "open" if both ceilings are sky):
-                && (backsector->ceilingpic != skyflatnum ||
-                    frontsector->ceilingpic!= skyflatnum)
+                && (back->ceilingpic != skyflatnum ||
+                    front->ceilingpic!= skyflatnum)
                 )
             )
-        linedef->r_flags = (RF_CLOSED | (linedef->r_flags & ML_MAPPED));
+        return RF_CLOSED;
     else
     {
         // Reject empty lines used for triggers
@@ -2241,20 +2745,56 @@ static void R_RecalcLineFlags(void)
         // identical light levels on both sides,
         // and no middle texture.
         // CPhipps - recode for speed, not certain if this is portable though
-        if (backsector->ceilingheight != frontsector->ceilingheight
-                || backsector->floorheight != frontsector->floorheight
+        if (back->ceilingheight != front->ceilingheight
+                || back->floorheight != front->floorheight
                 || side->midtexture
-                || backsector->ceilingpic != frontsector->ceilingpic
-                || backsector->floorpic != frontsector->floorpic
-                || backsector->lightlevel != frontsector->lightlevel)
+                || back->ceilingpic != front->ceilingpic
+                || back->floorpic != front->floorpic
+                || back->lightlevel != front->lightlevel)
         {
-            linedef->r_flags = (linedef->r_flags & ML_MAPPED);
+            return 0;
         } else
-            linedef->r_flags = (RF_IGNORE | (linedef->r_flags & ML_MAPPED));
+            return RF_IGNORE;
     }
 }
 
 
+static void R_RecalcLineFlags(line_t __far* line)
+{
+    int16_t flags = (line->r_flags & ML_MAPPED) | R_CalcLineFlags(line, 0);
+
+    if (line->sidenum[1] != NO_INDEX)
+        flags |= R_CalcLineFlags(line, 1) << RF_BACKSHIFT;
+
+    line->r_flags = flags;
+}
+
+
+//
+// R_InitLineFlags
+// Called at level load.
+//
+void R_InitLineFlags(void)
+{
+    for (int16_t i = 0; i < _g_numlines; i++)
+        R_RecalcLineFlags(&_g_lines[i]);
+}
+
+
+//
+// R_SectorChanged
+// Called when the heights, flats, lighting or wall textures
+// of a sector change.
+//
+void R_SectorChanged(const sector_t __far* sector)
+{
+    for (int16_t i = 0; i < sector->linecount; i++)
+        R_RecalcLineFlags(&_g_lines[sector->lines[i] - _g_lines]);
+
+    R_InvalidateSector(sector);
+}
+
+
 // CPhipps -
 // R_ClipWallSegment
 //
@@ -2263,33 +2803,27 @@ static void R_RecalcLineFlags(void)
 
 static void R_ClipWallSegment(int16_t first, int16_t last, const boolean solid)
 {
-    byte *p;
     while (first < last)
     {
-        if (solidcol[first])
-        {
-            if (!(p = memchr(solidcol+first, 0, last-first)))
-                return; // All solid
+        first = R_FindSolidCol(first, last, false);
+        if (first == last)
+            return; // All solid
 
-            first = p - solidcol;
-        }
-        else
-        {
-            int16_t to;
-            if (!(p = memchr(solidcol+first, 1, last-first)))
-                to = last;
-            else
-                to = p - solidcol;
+        int16_t to = R_FindSolidCol(first, last, true);
 
-            R_StoreWallRange(first, to-1);
+        // Every column in [first, to) is open, so the count afterwards doesn't
+        // depend on which of them R_RenderSegLoop has marked solid already.
+        int16_t count = solidcolcount;
 
-            if (solid)
-            {
-                memset(solidcol + first, 1, to - first);
-            }
+        R_StoreWallRange(first, to-1);
 
-            first = to;
+        if (solid)
+        {
+            R_SetSolidCols(first, to);
+            solidcolcount = count + (to - first);
         }
+
+        first = to;
     }
 }
 
@@ -2358,15 +2892,17 @@ static void R_AddLine(const seg_t __far* line)
 
     backsector = line->backsectornum != NO_INDEX8 ? &_g_sectors[line->backsectornum] : NULL;
 
+    if (backsector)
+        R_MarkSectorVisible(backsector);
+
     /* cph - roll up linedef properties in flags */
     linedef = &_g_lines[curline->linenum];
 
-    if (linedef->r_validcount != (uint16_t)_g_gametic)
-        R_RecalcLineFlags();
+    const int16_t r_flags = R_LineFlags();
 
-    if (!(linedef->r_flags & RF_IGNORE))
+    if (!(r_flags & RF_IGNORE))
     {
-        R_ClipWallSegment (x1, x2, linedef->r_flags & RF_CLOSED);
+        R_ClipWallSegment (x1, x2, r_flags & RF_CLOSED);
     }
 }
 
@@ -2406,6 +2942,8 @@ static void R_Subsector(int16_t num)
     sub = &_g_subsectors[num];
     frontsector = sub->sector;
     count = sub->numlines;
+
+    R_MarkSectorVisible(frontsector);
     line = &_g_segs[sub->firstline];
 
     if (frontsector->floorheight < viewz)
@@ -2498,7 +3036,7 @@ static boolean R_CheckBBox(const int16_t __far* bspcoord)
     if (sx1 == sx2)
         return false;
 
-    if (!memchr(solidcol+sx1, 0, sx2-sx1)) return false;
+    if (R_FindSolidCol(sx1, sx2, false) == sx2) return false;
     // All columns it covers are already solidly covered
 
 
@@ -2550,8 +3088,13 @@ static void R_RenderBSPNode(int16_t bspnum)
     while(true)
     {
         //Front sides.
-        while (!R_RenderBspSubsector(bspnum))
+        while (solidcolcount != viewwindowwidth)
         {
+            STAT_INC(bspnodes);
+
+            if (R_RenderBspSubsector(bspnum))
+                break;
+
             if(sp == MAX_BSP_DEPTH)
                 break;
 
@@ -2599,6 +3142,12 @@ static void R_RenderBSPNode(int16_t bspnum)
 #else
 static void R_RenderBSPNode(int16_t bspnum)
 {
+	// Nothing behind a full screen can be visible
+	if (solidcolcount == viewwindowwidth)
+		return;
+
+	STAT_INC(bspnodes);
+
 	if (R_RenderBspSubsector(bspnum))
 		return;
 
@@ -2624,7 +3173,8 @@ static void R_ClearDrawSegs(void)
 
 static void R_ClearClipSegs (void)
 {
-    memset(solidcol, 0, VIEWWINDOWWIDTH);
+    memset(solidcol, 0, sizeof(solidcol));
+    solidcolcount = 0;
 }
 
 
@@ -2662,6 +3212,15 @@ static void R_SetupFrame (player_t *player)
 //
 void R_RenderPlayerView (player_t* player)
 {
+#if defined RENDER_SKIP
+    viewwindowchanged = R_NeedsRendering(player);
+    if (!viewwindowchanged)
+    {
+        STAT_INC(skippedframes);
+        return;
+    }
+#endif
+
     R_SetupFrame (player);
 
     // Clear buffers.
@@ -2675,226 +3234,95 @@ void R_RenderPlayerView (player_t* player)
     // The head node is the last node output.
     R_RenderBSPNode (numnodes-1);
 
+#if defined DEFERRED_COLUMNS && !defined FLAT_WALL
+    // draw the queued wall columns before the sprites
+    R_FlushWallColumns();
+#endif
+
     R_DrawMasked ();
+
+#if defined RENDER_SKIP
+    R_CheckThings(true);
+#endif
 }
 
 
-static const int8_t viewangletoxTable[VIEWANGLETOXTABLESIZE] =
-{
-#if VIEWWINDOWWIDTH == 80
-    79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
-    78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
-    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
-    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
-    75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
-    74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
-    73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
-    72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
-    71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71,
-    70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70,
-    69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-    68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
-    67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
-    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
-    65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
-    64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
-    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
-    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
-    61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
-    60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
-    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
-    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
-    55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55,
-    54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
-    53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
-    52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
-    51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
-    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
-    49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
-    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-    47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
-    46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
-    45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
-    44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
-    43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43,
-    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
-    41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
-    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
-    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
-    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
-    37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
-    36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
-    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
-    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
-    30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
-    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
-    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
-    27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
-    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
-    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
-    24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
-    23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
-    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
-    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
-    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
-    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
-    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
-    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
-    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
-    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
-    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
-    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
-    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
-    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
-    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
-    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
-    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1
-#elif VIEWWINDOWWIDTH == 60
-    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
-    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
-    55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55,
-    54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
-    53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
-    52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
-    51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
-    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
-    49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
-    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-    47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
-    46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
-    45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
-    44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
-    43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43,
-    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
-    41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
-    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
-    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
-    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
-    37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
-    36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
-    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
-    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
-    30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
-    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
-    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
-    27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
-    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
-    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
-    24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
-    23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
-    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
-    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
-    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
-    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
-    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
-    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
-    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
-    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
-    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
-    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
-    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
-    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
-    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
-    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
-    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1
-#elif VIEWWINDOWWIDTH == 40
-    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
-    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
-    37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
-    36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
-    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
-    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
-    30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
-    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
-    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
-    27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
-    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
-    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
-    24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
-    23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
-    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
-    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
-    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
-    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
-    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
-    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
-    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
-    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
-    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
-    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
-    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
-    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
-    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
-    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
-    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1
-#elif VIEWWINDOWWIDTH == 30
-    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
-    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
-    27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
-    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
-    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
-    24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
-    23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
-    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
-    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
-    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
-    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
-    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
-    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
-    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
-    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
-    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
-    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
-    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
-    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
-    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
-    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
-    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1
-#else
-#error unsupported VIEWWINDOWWIDTH value
-#endif
-};
+//
+// R_InitTextureMapping
+// Generates the projection tables for viewwindowwidth,
+// which can be anything from 1 to VIEWWINDOWWIDTH.
+//
+
+void R_InitTextureMapping(void)
+{
+    if (viewwindowwidth < 1 || VIEWWINDOWWIDTH < viewwindowwidth)
+        I_Error("R_InitTextureMapping: view window width %i not in 1..%i", viewwindowwidth, VIEWWINDOWWIDTH);
+
+    centerx       = viewwindowwidth / 2;
+    projection    = (fixed_t)centerx << FRACBITS;
+    pspritescale  = FRACUNIT * viewwindowwidth / SCREENWIDTH_VGA;
+    pspriteiscale = FRACUNIT * SCREENWIDTH_VGA / viewwindowwidth;
+
+    // Calc focallength
+    //  so FIELDOFVIEW angles covers SCREENWIDTH.
+    // focallength = FixedDiv(projection, finetangent[FINEANGLES/4+FIELDOFVIEW/2])
+    const uint32_t tan45 = finetangentTable_part_4[0];
+    const fixed_t focallength = centerx * (UINT32_MAX / tan45) + centerx * (UINT32_MAX % tan45 + 1) / tan45;
+
+    // Use tangent table to generate viewangletox:
+    //  viewangletox will give the next greatest x
+    //  after the view angle.
+    for (int16_t i = VIEWANGLETOXTABLESTART; i < VIEWANGLETOXTABLEEND; i++)
+    {
+        fixed_t tan;
+        if (i < 1024)
+            tan = -finetangentTable_part_4[1023 - i];
+        else if (i < 2048)
+            tan = -(fixed_t)finetangentTable_part_3[1023 - (i - 1024)];
+        else if (i < 3072)
+            tan = finetangentTable_part_3[i - 2048];
+        else
+            tan = finetangentTable_part_4[i - 3072];
+
+        fixed_t t = (projection - FixedMul(tan, focallength) + FRACUNIT - 1) >> FRACBITS;
+
+        if (t < -1)
+            t = -1;
+        else if (t > viewwindowwidth + 1)
+            t = viewwindowwidth + 1;
+
+        viewangletoxTable[i - VIEWANGLETOXTABLESTART] = t;
+    }
+
+    // Scan viewangletox[] to generate xtoviewangle[]:
+    //  xtoviewangle will give the smallest view angle
+    //  that maps to x.
+    for (int16_t x = 0; x <= viewwindowwidth; x++)
+    {
+        int16_t i = VIEWANGLETOXTABLESTART;
+        while (i < VIEWANGLETOXTABLEEND && viewangletoxTable[i - VIEWANGLETOXTABLESTART] > x)
+            i++;
+
+        xtoviewangleTable[x] = (i << ANGLETOFINESHIFT_16) - ANG90_16;
+    }
+
+    // Take out the fencepost cases from viewangletox.
+    for (int16_t i = 0; i < VIEWANGLETOXTABLESIZE; i++)
+    {
+        if (viewangletoxTable[i] == -1)
+            viewangletoxTable[i] = 0;
+        else if (viewangletoxTable[i] == viewwindowwidth + 1)
+            viewangletoxTable[i] = viewwindowwidth;
+    }
+
+    clipangle = xtoviewangleTable[0];
+
+    for (int16_t x = 0; x < viewwindowwidth; x++)
+    {
+        screenheightarray[x] = VIEWWINDOWHEIGHT;
+        negonearray[x]       = -1;
+    }
+}
 
 
 // ArcTan LUT,
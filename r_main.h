@@ -72,6 +72,9 @@ angle_t R_PointToAngle3(fixed_t x, fixed_t y);
 subsector_t __far* R_PointInSubsector(fixed_t x, fixed_t y);
 
 void R_InitColormaps(void);
+void R_InitTextureMapping(void);
+
+extern int16_t viewwindowwidth;
 
 
 //
@@ -80,8 +83,24 @@ void R_InitColormaps(void);
 
 void R_RenderPlayerView(player_t *player);   // Called by G_Drawer.
 
+void R_InitLineFlags(void);
+void R_SectorChanged(const sector_t __far* sector);
+
+#if defined RENDER_SKIP
+extern boolean viewwindowchanged;              // false when R_RenderPlayerView skipped the frame
+
+void R_InvalidateView(void);
+void R_InvalidateSector(const sector_t __far* sector);
+#else
+#define R_InvalidateView()	((void)0)
+#define R_InvalidateSector(sector)	((void)0)
+#endif
+
 void R_DrawColumn (const draw_column_vars_t *dcvars);
 void R_DrawColumnFlat(uint8_t col, const draw_column_vars_t *dcvars);
+#if defined WIDE_COLUMNS
+void R_DrawColumnWide(const draw_column_vars_t *dcvars, int16_t width);
+#endif
 
 
 #endif
@@ -0,0 +1,114 @@
+//
+//
+// Copyright (C) 2026 Frenkel Smeijers
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+// DESCRIPTION:
+//  Division free SlopeDiv16 for R_PointToAngle16.
+//  Included by r_draw.c with -DRECIPROCAL_SLOPEDIV,
+//  and by tools/slopediv.c, which checks it exhaustively.
+//
+
+#ifndef __R_SLOPE__
+#define __R_SLOPE__
+
+#include <stdint.h>
+
+#include "doomtype.h"
+
+// 2^30 / d for the middle of each range of 128 normalized divisors,
+// d = 0x8000 + 128 * i .. 0x8000 + 128 * i + 127
+static const uint16_t slopeReciprocalTable[256] =
+{
+	32704, 32577, 32451, 32326, 32202, 32079, 31957, 31835,
+	31715, 31596, 31477, 31359, 31242, 31127, 31011, 30897,
+	30784, 30671, 30560, 30449, 30339, 30229, 30121, 30013,
+	29906, 29800, 29694, 29589, 29485, 29382, 29280, 29178,
+	29077, 28976, 28876, 28777, 28679, 28581, 28484, 28388,
+	28292, 28197, 28103, 28009, 27916, 27823, 27731, 27640,
+	27549, 27459, 27369, 27280, 27192, 27104, 27016, 26930,
+	26844, 26758, 26673, 26588, 26504, 26421, 26338, 26255,
+	26174, 26092, 26011, 25931, 25851, 25771, 25693, 25614,
+	25536, 25459, 25382, 25305, 25229, 25153, 25078, 25003,
+	24929, 24855, 24782, 24709, 24636, 24564, 24492, 24421,
+	24350, 24280, 24210, 24140, 24071, 24002, 23933, 23865,
+	23797, 23730, 23663, 23597, 23530, 23465, 23399, 23334,
+	23269, 23205, 23141, 23077, 23014, 22951, 22888, 22826,
+	22764, 22703, 22641, 22580, 22520, 22459, 22399, 22340,
+	22280, 22221, 22163, 22104, 22046, 21988, 21931, 21874,
+	21817, 21760, 21704, 21648, 21592, 21537, 21482, 21427,
+	21372, 21318, 21264, 21210, 21157, 21103, 21050, 20998,
+	20945, 20893, 20841, 20790, 20738, 20687, 20636, 20586,
+	20535, 20485, 20435, 20385, 20336, 20287, 20238, 20189,
+	20141, 20092, 20044, 19997, 19949, 19902, 19855, 19808,
+	19761, 19715, 19668, 19622, 19577, 19531, 19486, 19441,
+	19396, 19351, 19306, 19262, 19218, 19174, 19130, 19087,
+	19043, 19000, 18957, 18915, 18872, 18830, 18787, 18745,
+	18704, 18662, 18621, 18579, 18538, 18497, 18457, 18416,
+	18376, 18336, 18296, 18256, 18216, 18177, 18138, 18098,
+	18059, 18021, 17982, 17944, 17905, 17867, 17829, 17791,
+	17754, 17716, 17679, 17642, 17605, 17568, 17531, 17494,
+	17458, 17422, 17386, 17350, 17314, 17278, 17243, 17207,
+	17172, 17137, 17102, 17067, 17033, 16998, 16964, 16930,
+	16895, 16862, 16828, 16794, 16760, 16727, 16694, 16661,
+	16628, 16595, 16562, 16529, 16497, 16464, 16432, 16400
+};
+
+
+//
+// SlopeDiv16
+// Same result as n * SLOPERANGE / d for 0 < d and 0 <= n <= d <= 32768.
+// d == 0, a point at the view origin, returns 0 instead of faulting.
+// The divisor is normalized to 16 bits, the quotient is estimated with
+// a reciprocal and corrected with the remainder, which takes at most four
+// steps and usually none or one.
+//
+
+static CONSTFUNC int16_t SlopeDiv16(uint16_t n, uint16_t d)
+{
+	if (!d)
+		return 0;
+
+	if (!(d & 0xff00))
+	{
+		n <<= 8;
+		d <<= 8;
+	}
+
+	while (!(d & 0x8000))
+	{
+		n <<= 1;
+		d <<= 1;
+	}
+
+	int16_t q = ((uint32_t)n * slopeReciprocalTable[(d >> 7) - 0x100] + (1L << 18)) >> 19;
+	int32_t r = ((uint32_t)n << 11) - (uint32_t)q * d;
+
+	while (r < 0)
+	{
+		q--;
+		r += d;
+	}
+
+	while (r >= d)
+	{
+		q++;
+		r -= d;
+	}
+
+	return q;
+}
+
+#endif
@@ -171,6 +171,12 @@ static int16_t      st_randomnumber;
 
 static int8_t st_palette;
 
+// present the whole status bar, set by ST_Start
+static boolean st_fullrefresh;
+
+st_rect_t st_dirtyrects[ST_MAXDIRTYRECTS];
+int16_t   st_numdirtyrects;
+
 
 // Size of statusbar.
 // Now sensitive for scaling.
@@ -719,44 +725,140 @@ void ST_doRefresh(void)
 }
 
 
+//
+// ST_MarkDirty()
+//
+// Adds an area, in screen coordinates, to the dirty rectangles.
+// When the list is full, the last rectangle grows to cover the area.
+//
+static void ST_MarkDirty(int16_t x, int16_t y, int16_t w, int16_t h)
+{
+    int16_t x2 = x + w;
+    int16_t y2 = y + h - ST_Y;
+    y -= ST_Y;
+
+    if (x < 0)
+        x = 0;
+    if (y < 0)
+        y = 0;
+    if (x2 > (int16_t)SCREENWIDTH)
+        x2 = SCREENWIDTH;
+    if (y2 > ST_HEIGHT)
+        y2 = ST_HEIGHT;
+
+    if (x >= x2 || y >= y2)
+        return;
+
+    if (st_numdirtyrects < ST_MAXDIRTYRECTS)
+    {
+        st_rect_t* r = &st_dirtyrects[st_numdirtyrects++];
+        r->x = x;
+        r->y = y;
+        r->w = x2 - x;
+        r->h = y2 - y;
+    }
+    else
+    {
+        st_rect_t* r = &st_dirtyrects[ST_MAXDIRTYRECTS - 1];
+        if (x2 < r->x + r->w)
+            x2 = r->x + r->w;
+        if (y2 < r->y + r->h)
+            y2 = r->y + r->h;
+        if (x > r->x)
+            x = r->x;
+        if (y > r->y)
+            y = r->y;
+
+        r->x = x;
+        r->y = y;
+        r->w = x2 - x;
+        r->h = y2 - y;
+    }
+}
+
+
+static void ST_MarkPatch(int16_t x, int16_t y, int16_t num)
+{
+    const patch_t __far* patch = W_GetLumpByNum(num);
+    ST_MarkDirty(x - patch->leftoffset, y - patch->topoffset, patch->width, patch->height);
+    Z_ChangeTagToCache(patch);
+}
+
+
+// all digits of a number widget, right-aligned at n->x
+static void ST_MarkNumber(const st_number_t* n)
+{
+    const patch_t __far* patch = W_GetLumpByNum(n->p[0]);
+    const int16_t w = n->width * patch->width;
+    ST_MarkDirty(n->x - w - patch->leftoffset, n->y - patch->topoffset, w, patch->height);
+    Z_ChangeTagToCache(patch);
+}
+
+
+// the old and the new icon of a multicon widget
+static void ST_MarkMultIcon(const st_multicon_t* mi)
+{
+    if (!mi->p)
+        return;
+
+    if (mi->oldinum != -1)
+        ST_MarkPatch(mi->x, mi->y, mi->p[mi->oldinum]);
+
+    if (*mi->inum != -1)
+        ST_MarkPatch(mi->x, mi->y, mi->p[*mi->inum]);
+}
+
+
+//
+// ST_NeedUpdate()
+//
+// Marks the widgets that changed as dirty.
+// Returns true if the status bar has to be redrawn.
+//
 boolean ST_NeedUpdate(void)
 {
+    if (st_fullrefresh)
+    {
+        st_fullrefresh = false;
+        ST_MarkDirty(0, ST_Y, SCREENWIDTH, ST_HEIGHT);
+    }
+
 	// ready weapon ammo
 	if(w_ready.oldnum != *w_ready.num)
-        return true;
+        ST_MarkNumber(&w_ready);
 	
     if(st_health.oldnum != *st_health.num)
-        return true;
+        ST_MarkNumber(&st_health);
 
     if(st_armor.oldnum != *st_armor.num)
-        return true;
+        ST_MarkNumber(&st_armor);
 
     if(w_faces.oldinum != *w_faces.inum)
-        return true;
+        ST_MarkMultIcon(&w_faces);
 	
 	// ammo
     for(int8_t i=0; i<4; i++)
     {
         if(w_ammo[i].oldnum != *w_ammo[i].num)
-            return true;
+            ST_MarkNumber(&w_ammo[i]);
 		if(w_maxammo[i].oldnum != *w_maxammo[i].num)
-            return true;
+            ST_MarkNumber(&w_maxammo[i]);
     }
 
     // weapons owned
     for(int8_t i=0; i<6; i++)
     {
         if(w_arms[i].oldinum != *w_arms[i].inum)
-            return true;
+            ST_MarkMultIcon(&w_arms[i]);
     }
 
     for(int8_t i = 0; i < 3; i++)
     {
         if(w_keyboxes[i].oldinum != *w_keyboxes[i].inum)
-            return true;
+            ST_MarkMultIcon(&w_keyboxes[i]);
     }
 
-    return false;
+    return st_numdirtyrects != 0;
 }
 
 
@@ -930,6 +1032,7 @@ void ST_Start(void)
     ST_Stop();
   ST_initData();
   ST_createWidgets();
+  st_fullrefresh = true;
   st_stopped = false;
 }
 
@@ -44,6 +44,21 @@
 #define ST_HEIGHT 32
 
 
+// Areas of the status bar that changed since they were last presented,
+// with y relative to the top of the status bar.
+// The backends convert only these areas and then clear the list.
+
+#define ST_MAXDIRTYRECTS 8
+
+typedef struct
+{
+  int16_t x, y, w, h;
+} st_rect_t;
+
+extern st_rect_t st_dirtyrects[ST_MAXDIRTYRECTS];
+extern int16_t   st_numdirtyrects;
+
+
 //
 // STATUS BAR
 //
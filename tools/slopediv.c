@@ -0,0 +1,72 @@
+//
+//
+// Copyright (C) 2026 Frenkel Smeijers
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+// DESCRIPTION:
+//  Host check for SlopeDiv16 in r_slope.h, which r_draw.c uses with
+//  -DRECIPROCAL_SLOPEDIV. Compares it with the division it replaces for
+//  every 0 <= n <= d <= 32768, which is every input R_PointToAngle16
+//  can produce.
+//
+//  d == 0 is skipped: it only happens for a point at the view origin,
+//  where the division faults and SlopeDiv16 returns 0.
+//
+//  cc -O2 -I. -o slopediv tools/slopediv.c && ./slopediv
+//
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "r_slope.h"
+
+#define SLOPERANGE 2048
+
+
+static int16_t SlopeDiv16Division(uint16_t n, uint16_t d)
+{
+	return ((uint32_t)n * SLOPERANGE) / d;
+}
+
+
+int main(void)
+{
+	uint32_t n, d;
+	uint32_t errors = 0;
+
+	if (SlopeDiv16(0, 0) != 0)
+	{
+		printf("SlopeDiv16(0, 0) != 0\n");
+		errors++;
+	}
+
+	for (d = 1; d <= 32768; d++)
+	{
+		for (n = 0; n <= d; n++)
+		{
+			int16_t q = SlopeDiv16(n, d);
+			int16_t e = SlopeDiv16Division(n, d);
+			if (q != e)
+			{
+				if (errors < 10)
+					printf("SlopeDiv16(%u, %u) = %d, expected %d\n", n, d, q, e);
+				errors++;
+			}
+		}
+	}
+
+	printf("%u differences\n", errors);
+	return errors ? 1 : 0;
+}